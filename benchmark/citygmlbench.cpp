@@ -0,0 +1,849 @@
+/* -*-c++-*- libcitygml - Copyright (c) 2010 Joachim Pouderoux, BRGM
+*
+* This file is part of libcitygml library
+* http://code.google.com/p/libcitygml
+*
+* libcitygml is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 2.1 of the License, or
+* (at your option) any later version.
+*
+* libcitygml is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*/
+
+// Micro-benchmarks for the performance critical parts of libcitygml.
+// Each benchmark compares the current implementation with the implementation it replaced (or an alternative) on
+// real CityGML data and checks that both produce the same results.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <cctype>
+#include <unordered_map>
+#include <cstdio>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <citygml/citygml.h>
+#include <citygml/citygmllogger.h>
+#include <citygml/citygmlfactory.h>
+#include <citygml/citymodel.h>
+#include <citygml/cityobject.h>
+#include <citygml/geometry.h>
+#include <citygml/implictgeometry.h>
+#include <citygml/polygon.h>
+#include <citygml/vertexpool.h>
+#include <citygml/linearring.h>
+#include <citygml/tesselator.h>
+#include <citygml/earclippingtesselator.h>
+#include <citygml/vecs.hpp>
+#include <parser/numberparser.hpp>
+#include <parser/nodetypes.h>
+
+#ifndef LIBCITYGML_BENCHMARK_DATA
+#define LIBCITYGML_BENCHMARK_DATA "data/berlin_open_data_sample_data.citygml"
+#endif
+
+void usage()
+{
+    std::cout << "Usage: citygmlbench <benchmark> [<filename>...]" << std::endl;
+    std::cout << " Benchmarks:" << std::endl;
+    std::cout << "  numbers         gml:posList parsing (number scanner vs. std::stringstream)" << std::endl;
+    std::cout << "  fastpath        Polygon finish (convex fan triangulation fast path vs. GLU only)" << std::endl;
+    std::cout << "  tesselators     Polygon tesselation (ear clipping vs. GLU), compares the triangulations of all given files" << std::endl;
+    std::cout << "  nodenames       Element name lookup (node name table vs. std::unordered_map) on the elements of all given files" << std::endl;
+    std::cout << "  arena [<n>]     Load and teardown of a synthetic model with n buildings (heap vs. ParserParams::objectArena)" << std::endl;
+    std::cout << "  pools [<n>]     Bounding box of a synthetic model with n buildings (polygon vertex lists vs. ParserParams::vertexPools)" << std::endl;
+    std::cout << "                  and the memory of the vertex pool vs. ParserParams::compactVertices" << std::endl;
+    std::cout << " The default file is " << LIBCITYGML_BENCHMARK_DATA << std::endl;
+    exit( EXIT_FAILURE );
+}
+
+std::string readFile( const std::string& fileName )
+{
+    std::ifstream file( fileName, std::ios::in | std::ios::binary );
+    if ( !file ) {
+        std::cerr << "Could not open file " << fileName << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+// Returns the character data of all elements with the given (qualified) name
+std::vector<std::string> extractElementContents( const std::string& content, const std::string& elementName )
+{
+    std::vector<std::string> result;
+    const std::string startTag = "<" + elementName;
+    const std::string endTag = "</" + elementName + ">";
+
+    size_t pos = content.find( startTag );
+    while ( pos != std::string::npos ) {
+        size_t begin = content.find( '>', pos );
+        size_t end = content.find( endTag, begin );
+        if ( begin == std::string::npos || end == std::string::npos ) {
+            break;
+        }
+        if ( content[begin - 1] != '/' && ( content[pos + startTag.size()] == '>' || content[pos + startTag.size()] == ' ' ) ) {
+            result.push_back( content.substr( begin + 1, end - begin - 1 ) );
+        }
+        pos = content.find( startTag, end );
+    }
+    return result;
+}
+
+// Runs func iterations times and returns the mean time of one run in milliseconds
+double measure( const std::function<void()>& func, int iterations )
+{
+    func(); // warm up
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for ( int i = 0; i < iterations; i++ ) {
+        func();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>( end - start ).count() / iterations;
+}
+
+void printResult( const std::string& name, double ms, double baselineMs )
+{
+    std::cout << "  " << name << ": " << ms << " ms";
+    if ( baselineMs > 0.0 ) {
+        std::cout << " (x" << baselineMs / ms << ")";
+    }
+    std::cout << std::endl;
+}
+
+// The std::stringstream based list parsing that was used before the number scanner
+template<class T> std::vector<T> parseVecListStringStream( const std::string& s )
+{
+    std::stringstream ss;
+    ss << s;
+
+    T v;
+    std::vector<T> vec;
+    while ( ss >> v )
+        vec.push_back( v );
+
+    return vec;
+}
+
+int benchmarkNumbers( const std::string& content )
+{
+    const std::vector<std::string> posLists = extractElementContents( content, "gml:posList" );
+
+    size_t numbers = 0;
+    for ( const std::string& posList : posLists ) {
+        numbers += citygml::countNumberTokens( posList.data(), posList.data() + posList.size() );
+    }
+    std::cout << "Parsing " << posLists.size() << " gml:posList elements with " << numbers << " numbers" << std::endl;
+
+    // Both implementations must yield the same values
+    for ( const std::string& posList : posLists ) {
+        std::vector<TVec3d> expected = parseVecListStringStream<TVec3d>( posList );
+        std::vector<TVec3d> actual;
+        citygml::parseNumberList( posList.data(), posList.data() + posList.size(), actual );
+        if ( expected != actual ) {
+            std::cerr << "Number scanner result differs from std::stringstream result for '" << posList << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const int iterations = 20;
+    size_t checksum = 0;
+
+    double streamMs = measure( [&]() {
+        for ( const std::string& posList : posLists ) {
+            checksum += parseVecListStringStream<TVec3d>( posList ).size();
+        }
+    }, iterations );
+
+    double scannerMs = measure( [&]() {
+        for ( const std::string& posList : posLists ) {
+            std::vector<TVec3d> vertices;
+            citygml::parseNumberList( posList.data(), posList.data() + posList.size(), vertices );
+            checksum += vertices.size();
+        }
+    }, iterations );
+
+    printResult( "std::stringstream", streamMs, 0.0 );
+    printResult( "number scanner", scannerMs, streamMs );
+    std::cout << "  (checksum " << checksum << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+class BenchmarkLogger : public citygml::CityGMLLogger
+{
+public:
+    BenchmarkLogger() : citygml::CityGMLLogger( LOGLEVEL::LL_ERROR ) {}
+
+    virtual void log( LOGLEVEL, const std::string& message, const char*, int ) const override
+    {
+        std::cerr << message << std::endl;
+    }
+};
+
+void collectPolygons( const citygml::Geometry& geometry, std::vector<std::shared_ptr<const citygml::Polygon> >& polygons )
+{
+    for ( unsigned int i = 0; i < geometry.getPolygonsCount(); i++ ) {
+        polygons.push_back( geometry.getPolygon( i ) );
+    }
+    for ( unsigned int i = 0; i < geometry.getGeometriesCount(); i++ ) {
+        collectPolygons( geometry.getGeometry( i ), polygons );
+    }
+}
+
+void collectPolygons( const citygml::CityObject& object, std::vector<std::shared_ptr<const citygml::Polygon> >& polygons )
+{
+    for ( unsigned int i = 0; i < object.getGeometriesCount(); i++ ) {
+        collectPolygons( object.getGeometry( i ), polygons );
+    }
+    for ( unsigned int i = 0; i < object.getImplicitGeometryCount(); i++ ) {
+        const citygml::ImplicitGeometry& implicitGeometry = object.getImplicitGeometry( i );
+        for ( unsigned int j = 0; j < implicitGeometry.getGeometriesCount(); j++ ) {
+            collectPolygons( implicitGeometry.getGeometry( j ), polygons );
+        }
+    }
+    for ( unsigned int i = 0; i < object.getChildCityObjectsCount(); i++ ) {
+        collectPolygons( object.getChildCityObject( i ), polygons );
+    }
+}
+
+// Loads the file keeping the ring vertices so that the polygons can be finished again
+std::vector<std::shared_ptr<const citygml::Polygon> > loadPolygons( const std::string& fileName, std::shared_ptr<const citygml::CityModel>& city )
+{
+    citygml::ParserParams params;
+    params.keepVertices = true;
+
+    city = citygml::load( fileName, params, std::make_shared<BenchmarkLogger>() );
+    if ( !city ) {
+        std::cerr << "Could not load " << fileName << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    std::vector<std::shared_ptr<const citygml::Polygon> > polygons;
+    for ( unsigned int i = 0; i < city->getNumRootCityObjects(); i++ ) {
+        collectPolygons( city->getRootCityObject( i ), polygons );
+    }
+    return polygons;
+}
+
+// Creates unfinished copies (rings only) of the polygons
+std::vector<std::shared_ptr<citygml::Polygon> > copyPolygons( citygml::CityGMLFactory& factory, const std::vector<std::shared_ptr<const citygml::Polygon> >& polygons )
+{
+    std::vector<std::shared_ptr<citygml::Polygon> > copies;
+    copies.reserve( polygons.size() );
+    for ( const auto& polygon : polygons ) {
+        std::shared_ptr<citygml::Polygon> copy = factory.createPolygon( polygon->getId() );
+        copy->setNegNormal( polygon->negNormal() );
+        if ( polygon->exteriorRing() != nullptr ) {
+            citygml::LinearRing* ring = new citygml::LinearRing( polygon->exteriorRing()->getId(), true );
+            ring->setVertices( polygon->exteriorRing()->getVertices() );
+            copy->addRing( ring );
+        }
+        for ( const auto& interior : polygon->interiorRings() ) {
+            citygml::LinearRing* ring = new citygml::LinearRing( interior->getId(), false );
+            ring->setVertices( interior->getVertices() );
+            copy->addRing( ring );
+        }
+        copies.push_back( copy );
+    }
+    return copies;
+}
+
+int benchmarkFastPath( const std::string& fileName )
+{
+    std::shared_ptr<const citygml::CityModel> city;
+    const std::vector<std::shared_ptr<const citygml::Polygon> > polygons = loadPolygons( fileName, city );
+
+    size_t fastPathPolygons = 0;
+    for ( const auto& polygon : polygons ) {
+        const auto ring = polygon->exteriorRing();
+        if ( ring != nullptr && polygon->interiorRings().empty() && ring->isConvex( ring->computeNormal() ) ) {
+            fastPathPolygons++;
+        }
+    }
+    std::cout << "Finishing " << polygons.size() << " polygons, " << fastPathPolygons << " ("
+              << ( polygons.empty() ? 0.0 : 100.0 * fastPathPolygons / polygons.size() ) << "%) take the convex fast path" << std::endl;
+
+    std::shared_ptr<citygml::CityGMLLogger> logger = std::make_shared<BenchmarkLogger>();
+    const int iterations = 20;
+
+    auto finishAll = [&]( bool convexFastPath, size_t& triangles ) {
+        double ms = 0.0;
+        for ( int i = 0; i < iterations; i++ ) {
+            citygml::CityGMLFactory factory( logger );
+            std::vector<std::shared_ptr<citygml::Polygon> > copies = copyPolygons( factory, polygons );
+
+            Tesselator tesselator( logger );
+            tesselator.setConvexFastPath( convexFastPath );
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for ( auto& polygon : copies ) {
+                polygon->finish( tesselator, false, logger );
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            ms += std::chrono::duration<double, std::milli>( end - start ).count();
+
+            triangles = 0;
+            for ( auto& polygon : copies ) {
+                triangles += polygon->getIndices().size() / 3;
+            }
+        }
+        return ms / iterations;
+    };
+
+    size_t gluTriangles = 0;
+    size_t fastPathTriangles = 0;
+    double gluMs = finishAll( false, gluTriangles );
+    double fastPathMs = finishAll( true, fastPathTriangles );
+
+    printResult( "GLU only (" + std::to_string( gluTriangles ) + " triangles)", gluMs, 0.0 );
+    printResult( "convex fast path (" + std::to_string( fastPathTriangles ) + " triangles)", fastPathMs, gluMs );
+    return EXIT_SUCCESS;
+}
+
+// Triangulated area of the polygon and number of triangles that face against the polygon normal
+void measureTriangulation( const citygml::Polygon& polygon, double& area, size_t& flippedTriangles )
+{
+    area = 0.0;
+    flippedTriangles = 0;
+    if ( polygon.exteriorRing() == nullptr ) {
+        return;
+    }
+
+    TVec3d normal = polygon.exteriorRing()->computeNormal();
+    if ( polygon.negNormal() ) {
+        normal = -normal;
+    }
+
+    const std::vector<TVec3d>& vertices = polygon.getVertices();
+    const std::vector<unsigned int>& indices = polygon.getIndices();
+    for ( size_t i = 0; i + 2 < indices.size(); i += 3 ) {
+        const TVec3d& a = vertices[indices[i]];
+        const TVec3d cross = ( vertices[indices[i + 1]] - a ).cross( vertices[indices[i + 2]] - a );
+        area += cross.length() / 2.0;
+        if ( cross.dot( normal ) < 0.0 ) {
+            flippedTriangles++;
+        }
+    }
+}
+
+int benchmarkTesselators( const std::vector<std::string>& fileNames )
+{
+    std::shared_ptr<citygml::CityGMLLogger> logger = std::make_shared<BenchmarkLogger>();
+    const int iterations = 20;
+
+    for ( const std::string& fileName : fileNames ) {
+        std::shared_ptr<const citygml::CityModel> city;
+        const std::vector<std::shared_ptr<const citygml::Polygon> > polygons = loadPolygons( fileName, city );
+
+        size_t polygonsWithHoles = 0;
+        for ( const auto& polygon : polygons ) {
+            if ( !polygon->interiorRings().empty() ) {
+                polygonsWithHoles++;
+            }
+        }
+        std::cout << fileName << ": tesselating " << polygons.size() << " polygons (" << polygonsWithHoles << " with interior rings)" << std::endl;
+
+        // The convex fast path is disabled so that every polygon is passed to the tesselator
+        auto finishAll = [&]( TesselatorBase& tesselator, std::vector<std::shared_ptr<citygml::Polygon> >& result ) {
+            tesselator.setConvexFastPath( false );
+
+            double ms = 0.0;
+            for ( int i = 0; i < iterations; i++ ) {
+                citygml::CityGMLFactory factory( logger );
+                std::vector<std::shared_ptr<citygml::Polygon> > copies = copyPolygons( factory, polygons );
+
+                auto start = std::chrono::high_resolution_clock::now();
+                for ( auto& polygon : copies ) {
+                    polygon->finish( tesselator, false, logger );
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+                ms += std::chrono::duration<double, std::milli>( end - start ).count();
+
+                result = std::move( copies );
+            }
+            return ms / iterations;
+        };
+
+        Tesselator gluTesselator( logger );
+        EarClippingTesselator earClippingTesselator( logger );
+
+        std::vector<std::shared_ptr<citygml::Polygon> > gluPolygons;
+        std::vector<std::shared_ptr<citygml::Polygon> > earClippingPolygons;
+        const double gluMs = finishAll( gluTesselator, gluPolygons );
+        const double earClippingMs = finishAll( earClippingTesselator, earClippingPolygons );
+
+        size_t gluTriangles = 0;
+        size_t earClippingTriangles = 0;
+        size_t gluFlipped = 0;
+        size_t earClippingFlipped = 0;
+        size_t triangleCountDifferences = 0;
+        size_t areaDifferences = 0;
+        double gluArea = 0.0;
+        double earClippingArea = 0.0;
+
+        for ( size_t i = 0; i < polygons.size(); i++ ) {
+            double areaA, areaB;
+            size_t flippedA, flippedB;
+            measureTriangulation( *gluPolygons[i], areaA, flippedA );
+            measureTriangulation( *earClippingPolygons[i], areaB, flippedB );
+
+            const size_t trianglesA = gluPolygons[i]->getIndices().size() / 3;
+            const size_t trianglesB = earClippingPolygons[i]->getIndices().size() / 3;
+
+            gluTriangles += trianglesA;
+            earClippingTriangles += trianglesB;
+            gluFlipped += flippedA;
+            earClippingFlipped += flippedB;
+            gluArea += areaA;
+            earClippingArea += areaB;
+
+            if ( trianglesA != trianglesB ) {
+                triangleCountDifferences++;
+            }
+            // Non planar polygons may have slightly different areas since the triangulations differ
+            if ( std::fabs( areaA - areaB ) > 1e-4 * std::max( 1.0, areaA ) ) {
+                if ( areaDifferences++ < 10 ) std::cout << "  area of polygon " << polygons[i]->getId() << " differs: GLU " << areaA << ", ear clipping " << areaB << std::endl;
+            }
+        }
+
+        auto trianglesPerSecond = []( size_t triangles, double ms ) {
+            return ms > 0.0 ? static_cast<size_t>( triangles / ms * 1000.0 ) : 0;
+        };
+
+        printResult( "GLU (" + std::to_string( gluTriangles ) + " triangles, " + std::to_string( trianglesPerSecond( gluTriangles, gluMs ) ) + " triangles/s)", gluMs, 0.0 );
+        printResult( "ear clipping (" + std::to_string( earClippingTriangles ) + " triangles, " + std::to_string( trianglesPerSecond( earClippingTriangles, earClippingMs ) ) + " triangles/s)", earClippingMs, gluMs );
+        std::cout << "  total area: GLU " << gluArea << ", ear clipping " << earClippingArea << std::endl;
+        std::cout << "  polygons with different area: " << areaDifferences << ", with different triangle count: " << triangleCountDifferences << std::endl;
+        std::cout << "  triangles facing against the polygon normal: GLU " << gluFlipped << ", ear clipping " << earClippingFlipped << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
+
+// Returns the qualified names of all start tags in the order of the document
+std::vector<std::string> extractElementNames( const std::string& content )
+{
+    std::vector<std::string> result;
+    size_t pos = content.find( '<' );
+    while ( pos != std::string::npos ) {
+        size_t begin = pos + 1;
+        if ( begin < content.size() && ( std::isalpha( static_cast<unsigned char>( content[begin] ) ) || content[begin] == '_' ) ) {
+            size_t end = content.find_first_of( " \t\r\n/>", begin );
+            if ( end == std::string::npos ) {
+                break;
+            }
+            result.push_back( content.substr( begin, end - begin ) );
+        }
+        pos = content.find( '<', begin );
+    }
+    return result;
+}
+
+// The element name lookup that was used before the node name table: the UTF-16 name of the xml parser is transcoded,
+// lower cased and looked up in std::unordered_maps (names without prefix are looked up again with the core prefix).
+// The maps are filled with the element names of the benchmark files only.
+class UnorderedMapNodeLookup
+{
+public:
+    explicit UnorderedMapNodeLookup( const std::vector<std::string>& names )
+    {
+        for ( const std::string& name : names ) {
+            const citygml::NodeType::XMLNode& node = citygml::NodeType::getXMLNodeFor( name );
+            if ( !node.valid() ) {
+                continue;
+            }
+            const std::string lowerName = toLower( name );
+            const size_t pos = lowerName.find( ':' );
+            if ( pos != std::string::npos ) {
+                m_nodeNameWithPrefixTypeMap[lowerName] = &node;
+                m_nodeNameTypeMap[lowerName.substr( pos + 1 )] = &node;
+            } else {
+                m_nodeNameWithPrefixTypeMap["core:" + lowerName] = &node;
+                m_nodeNameTypeMap[lowerName] = &node;
+            }
+        }
+    }
+
+    const citygml::NodeType::XMLNode& getXMLNodeFor( const std::u16string& qname ) const
+    {
+        // Transcoding allocates a new string like xercesc::XMLString::transcode
+        return getXMLNodeFor( std::string( qname.begin(), qname.end() ) );
+    }
+
+    const citygml::NodeType::XMLNode& getXMLNodeFor( const std::string& name ) const
+    {
+        std::string lowerName = toLower( name );
+        {
+            auto it = m_nodeNameWithPrefixTypeMap.find( lowerName );
+            if ( it != m_nodeNameWithPrefixTypeMap.end() ) {
+                return *it->second;
+            }
+        }
+
+        std::string nodeName = lowerName;
+
+        size_t pos = nodeName.find_first_of( ":" );
+        if ( pos != std::string::npos ) {
+            nodeName = nodeName.substr( pos + 1 );
+        } else {
+            return getXMLNodeFor( "core:" + name );
+        }
+
+        auto it = m_nodeNameTypeMap.find( nodeName );
+        return it == m_nodeNameTypeMap.end() ? citygml::NodeType::InvalidNode : *it->second;
+    }
+
+private:
+    static std::string toLower( std::string str )
+    {
+        std::transform( str.begin(), str.end(), str.begin(), ::tolower );
+        return str;
+    }
+
+    std::unordered_map<std::string, const citygml::NodeType::XMLNode*> m_nodeNameTypeMap;
+    std::unordered_map<std::string, const citygml::NodeType::XMLNode*> m_nodeNameWithPrefixTypeMap;
+};
+
+int benchmarkNodeNames( const std::vector<std::string>& fileNames )
+{
+    std::vector<std::string> names;
+    for ( const std::string& fileName : fileNames ) {
+        const std::vector<std::string> fileElementNames = extractElementNames( readFile( fileName ) );
+        names.insert( names.end(), fileElementNames.begin(), fileElementNames.end() );
+    }
+
+    // The xml parser reports the names as UTF-16 strings
+    std::vector<std::u16string> utf16Names;
+    utf16Names.reserve( names.size() );
+    for ( const std::string& name : names ) {
+        utf16Names.push_back( std::u16string( name.begin(), name.end() ) );
+    }
+
+    const UnorderedMapNodeLookup unorderedMapLookup( names );
+
+    size_t unknownElements = 0;
+    for ( size_t i = 0; i < names.size(); i++ ) {
+        const citygml::NodeType::XMLNode& expected = unorderedMapLookup.getXMLNodeFor( utf16Names[i] );
+        const citygml::NodeType::XMLNode& node = citygml::NodeType::getXMLNodeFor( names[i] );
+        const citygml::NodeType::XMLNode& utf16Node = citygml::NodeType::getXMLNodeFor( utf16Names[i].data(), utf16Names[i].data() + utf16Names[i].size() );
+        if ( &expected != &node || &expected != &utf16Node ) {
+            std::cerr << "Node name table result differs from std::unordered_map result for '" << names[i] << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+        if ( !node.valid() ) {
+            unknownElements++;
+        }
+    }
+    std::cout << "Looking up " << names.size() << " element names (" << unknownElements << " unknown)" << std::endl;
+
+    const int iterations = 20;
+    int checksum = 0;
+
+    const double unorderedMapMs = measure( [&]() {
+        for ( const std::u16string& name : utf16Names ) {
+            checksum += unorderedMapLookup.getXMLNodeFor( name ).typeID();
+        }
+    }, iterations );
+
+    const double stringMs = measure( [&]() {
+        for ( const std::string& name : names ) {
+            checksum += citygml::NodeType::getXMLNodeFor( name ).typeID();
+        }
+    }, iterations );
+
+    const double utf16Ms = measure( [&]() {
+        for ( const std::u16string& name : utf16Names ) {
+            checksum += citygml::NodeType::getXMLNodeFor( name.data(), name.data() + name.size() ).typeID();
+        }
+    }, iterations );
+
+    auto elementsPerSecond = [&]( double ms ) {
+        return ms > 0.0 ? std::to_string( static_cast<size_t>( names.size() / ms * 1000.0 ) ) : std::string( "-" );
+    };
+
+    printResult( "std::unordered_map, transcoded (" + elementsPerSecond( unorderedMapMs ) + " elements/s)", unorderedMapMs, 0.0 );
+    printResult( "node name table, std::string (" + elementsPerSecond( stringMs ) + " elements/s)", stringMs, unorderedMapMs );
+    printResult( "node name table, UTF-16 (" + elementsPerSecond( utf16Ms ) + " elements/s)", utf16Ms, unorderedMapMs );
+    std::cout << "  (checksum " << checksum << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+// Writes a CityModel with the given number of LOD2 box buildings, every wall, roof and ground surface is a thematic surface
+// with a polygon of its own
+void writeSyntheticModel( const std::string& fileName, size_t buildings )
+{
+    std::ofstream file( fileName, std::ios::out | std::ios::binary );
+    if ( !file ) {
+        std::cerr << "Could not write file " << fileName << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+         << "<CityModel xmlns=\"http://www.opengis.net/citygml/2.0\" xmlns:gml=\"http://www.opengis.net/gml\""
+         << " xmlns:bldg=\"http://www.opengis.net/citygml/building/2.0\" xmlns:gen=\"http://www.opengis.net/citygml/generics/2.0\">\n";
+
+    const char* surfaceTypes[] = { "WallSurface", "WallSurface", "WallSurface", "WallSurface", "RoofSurface", "GroundSurface" };
+
+    for ( size_t b = 0; b < buildings; b++ ) {
+        const double x = static_cast<double>( b % 1000 ) * 20.0;
+        const double y = static_cast<double>( b / 1000 ) * 20.0;
+        const double corners[4][2] = { { x, y }, { x + 10.0, y }, { x + 10.0, y + 10.0 }, { x, y + 10.0 } };
+
+        file << "<cityObjectMember><bldg:Building gml:id=\"B" << b << "\">"
+             << "<gen:stringAttribute name=\"function\"><gen:value>residential</gen:value></gen:stringAttribute>"
+             << "<bldg:measuredHeight>10</bldg:measuredHeight>\n";
+
+        for ( int s = 0; s < 6; s++ ) {
+            std::vector<TVec3d> ring;
+            if ( s < 4 ) {
+                const double* a = corners[s];
+                const double* c = corners[( s + 1 ) % 4];
+                ring = { TVec3d( a[0], a[1], 0.0 ), TVec3d( c[0], c[1], 0.0 ), TVec3d( c[0], c[1], 10.0 ), TVec3d( a[0], a[1], 10.0 ) };
+            } else {
+                const double z = s == 4 ? 10.0 : 0.0;
+                for ( int i = 0; i < 4; i++ ) {
+                    ring.push_back( TVec3d( corners[s == 4 ? i : 3 - i][0], corners[s == 4 ? i : 3 - i][1], z ) );
+                }
+            }
+            ring.push_back( ring.front() );
+
+            file << "<bldg:boundedBy><bldg:" << surfaceTypes[s] << " gml:id=\"B" << b << "_S" << s << "\"><bldg:lod2MultiSurface><gml:MultiSurface>"
+                 << "<gml:surfaceMember><gml:Polygon gml:id=\"B" << b << "_P" << s << "\"><gml:exterior><gml:LinearRing><gml:posList>";
+            for ( size_t i = 0; i < ring.size(); i++ ) {
+                file << ( i > 0 ? " " : "" ) << ring[i].x << " " << ring[i].y << " " << ring[i].z;
+            }
+            file << "</gml:posList></gml:LinearRing></gml:exterior></gml:Polygon></gml:surfaceMember>"
+                 << "</gml:MultiSurface></bldg:lod2MultiSurface></bldg:" << surfaceTypes[s] << "></bldg:boundedBy>\n";
+        }
+
+        file << "</bldg:Building></cityObjectMember>\n";
+    }
+
+    file << "</CityModel>\n";
+}
+
+// The resident set size of the process in MB (0 if unknown)
+double residentSetSize()
+{
+#ifdef __linux__
+    std::ifstream statm( "/proc/self/statm" );
+    long pages = 0;
+    long residentPages = 0;
+    if ( statm >> pages >> residentPages ) {
+        return static_cast<double>( residentPages ) * sysconf( _SC_PAGESIZE ) / ( 1024.0 * 1024.0 );
+    }
+#endif
+    return 0.0;
+}
+
+int benchmarkArena( size_t buildings )
+{
+    const std::string fileName = "citygmlbench_synthetic.gml";
+    writeSyntheticModel( fileName, buildings );
+    std::cout << "Synthetic model with " << buildings << " buildings (" << buildings * 7 << " CityObjects, " << buildings * 6 << " polygons)" << std::endl;
+
+    const int iterations = 3;
+
+    auto loadAndTeardown = [&]( bool objectArena, double& loadMs, double& teardownMs, double& loadedMB, double& retainedMB ) -> size_t {
+        citygml::ParserParams params;
+        params.objectArena = objectArena;
+
+        loadMs = 0.0;
+        teardownMs = 0.0;
+        loadedMB = 0.0;
+        retainedMB = 0.0;
+        size_t polygons = 0;
+        for ( int i = 0; i < iterations; i++ ) {
+            const double rssBefore = residentSetSize();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            std::shared_ptr<const citygml::CityModel> city = citygml::load( fileName, params, std::make_shared<BenchmarkLogger>() );
+            auto loaded = std::chrono::high_resolution_clock::now();
+            if ( !city ) {
+                std::cerr << "Could not load " << fileName << std::endl;
+                exit( EXIT_FAILURE );
+            }
+
+            std::vector<std::shared_ptr<const citygml::Polygon> > cityPolygons;
+            for ( unsigned int j = 0; j < city->getNumRootCityObjects(); j++ ) {
+                collectPolygons( city->getRootCityObject( j ), cityPolygons );
+            }
+            polygons = cityPolygons.size();
+            cityPolygons.clear();
+
+            const double rssLoaded = residentSetSize();
+
+            auto teardownStart = std::chrono::high_resolution_clock::now();
+            city.reset();
+            auto end = std::chrono::high_resolution_clock::now();
+
+            loadMs += std::chrono::duration<double, std::milli>( loaded - start ).count();
+            teardownMs += std::chrono::duration<double, std::milli>( end - teardownStart ).count();
+            loadedMB = std::max( loadedMB, rssLoaded - rssBefore );
+            retainedMB = std::max( retainedMB, residentSetSize() - rssBefore );
+        }
+        loadMs /= iterations;
+        teardownMs /= iterations;
+        return polygons;
+    };
+
+    double heapLoadMs, heapTeardownMs, heapLoadedMB, heapRetainedMB;
+    double arenaLoadMs, arenaTeardownMs, arenaLoadedMB, arenaRetainedMB;
+    const size_t heapPolygons = loadAndTeardown( false, heapLoadMs, heapTeardownMs, heapLoadedMB, heapRetainedMB );
+    const size_t arenaPolygons = loadAndTeardown( true, arenaLoadMs, arenaTeardownMs, arenaLoadedMB, arenaRetainedMB );
+
+    std::remove( fileName.c_str() );
+
+    if ( heapPolygons != arenaPolygons ) {
+        std::cerr << "Polygon counts differ: " << heapPolygons << " vs. " << arenaPolygons << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << " load" << std::endl;
+    printResult( "heap", heapLoadMs, 0.0 );
+    printResult( "object arena", arenaLoadMs, heapLoadMs );
+    std::cout << " teardown" << std::endl;
+    printResult( "heap", heapTeardownMs, 0.0 );
+    printResult( "object arena", arenaTeardownMs, heapTeardownMs );
+    std::cout << " resident set growth after load / after teardown" << std::endl;
+    std::cout << "  heap: " << heapLoadedMB << " MB / " << heapRetainedMB << " MB" << std::endl;
+    std::cout << "  object arena: " << arenaLoadedMB << " MB / " << arenaRetainedMB << " MB" << std::endl;
+    std::cout << "  (the object arena runs reuse the heap memory that the heap runs released but the allocator kept)" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int benchmarkPools( size_t buildings )
+{
+    const std::string fileName = "citygmlbench_synthetic.gml";
+    writeSyntheticModel( fileName, buildings );
+    std::cout << "Synthetic model with " << buildings << " buildings (" << buildings * 6 << " polygons)" << std::endl;
+
+    citygml::ParserParams params;
+    std::shared_ptr<const citygml::CityModel> city = citygml::load( fileName, params, std::make_shared<BenchmarkLogger>() );
+    params.vertexPools = true;
+    std::shared_ptr<const citygml::CityModel> pooledCity = citygml::load( fileName, params, std::make_shared<BenchmarkLogger>() );
+    if ( !city || !pooledCity || !pooledCity->getVertexPool() ) {
+        std::cerr << "Could not load " << fileName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::shared_ptr<const citygml::Polygon> > polygons;
+    for ( unsigned int i = 0; i < city->getNumRootCityObjects(); i++ ) {
+        collectPolygons( city->getRootCityObject( i ), polygons );
+    }
+
+    const int iterations = 20;
+    TVec3d polygonsMin, polygonsMax, poolMin, poolMax;
+
+    auto extend = []( const TVec3d& v, TVec3d& min, TVec3d& max ) {
+        min = TVec3d( std::min( min.x, v.x ), std::min( min.y, v.y ), std::min( min.z, v.z ) );
+        max = TVec3d( std::max( max.x, v.x ), std::max( max.y, v.y ), std::max( max.z, v.z ) );
+    };
+
+    double polygonsMs = measure( [&]() {
+        polygonsMin = TVec3d( HUGE_VAL, HUGE_VAL, HUGE_VAL );
+        polygonsMax = -polygonsMin;
+        for ( const auto& polygon : polygons ) {
+            for ( const TVec3d& v : polygon->getVertices() ) {
+                extend( v, polygonsMin, polygonsMax );
+            }
+        }
+    }, iterations );
+
+    double poolMs = measure( [&]() {
+        poolMin = TVec3d( HUGE_VAL, HUGE_VAL, HUGE_VAL );
+        poolMax = -poolMin;
+        for ( const TVec3d& v : pooledCity->getVertexPool()->getPositions() ) {
+            extend( v, poolMin, poolMax );
+        }
+    }, iterations );
+
+    if ( !( polygonsMin == poolMin ) || !( polygonsMax == poolMax ) ) {
+        std::cerr << "Bounding boxes differ: " << polygonsMin << " " << polygonsMax << " vs. " << poolMin << " " << poolMax << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const size_t vertices = pooledCity->getVertexPool()->getPositions().size();
+    printResult( "polygon vertex lists (" + std::to_string( vertices ) + " vertices)", polygonsMs, 0.0 );
+    printResult( "vertex pool", poolMs, polygonsMs );
+
+    // The compact pool stores float offsets and 16 bit indices
+    params.vertexPools = false;
+    params.compactVertices = true;
+    std::shared_ptr<const citygml::CityModel> compactCity = citygml::load( fileName, params, std::make_shared<BenchmarkLogger>() );
+    std::remove( fileName.c_str() );
+    if ( !compactCity || !compactCity->getVertexPool() ) {
+        std::cerr << "Could not load " << fileName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::shared_ptr<const citygml::Polygon> > compactPolygons;
+    for ( unsigned int i = 0; i < compactCity->getNumRootCityObjects(); i++ ) {
+        collectPolygons( compactCity->getRootCityObject( i ), compactPolygons );
+    }
+    double maxError = 0.0;
+    for ( size_t i = 0; i < polygons.size() && i < compactPolygons.size(); i++ ) {
+        for ( size_t j = 0; j < polygons[i]->getVertexCount() && j < compactPolygons[i]->getVertexCount(); j++ ) {
+            maxError = std::max( maxError, ( polygons[i]->getVertex( j ) - compactPolygons[i]->getVertex( j ) ).length() );
+        }
+    }
+
+    const citygml::VertexPool& pool = *pooledCity->getVertexPool();
+    const citygml::VertexPool& compactPool = *compactCity->getVertexPool();
+    const size_t poolBytes = pool.getPositions().size() * sizeof( TVec3d ) + pool.getIndices().size() * sizeof( unsigned int );
+    const size_t compactBytes = compactPool.getLocalPositions().size() * sizeof( TVec3f ) + compactPool.getShortIndices().size() * sizeof( uint16_t )
+            + compactPool.getIndices().size() * sizeof( unsigned int ) + compactPool.getOriginsCount() * sizeof( TVec3d );
+    std::cout << " vertex and index memory" << std::endl;
+    std::cout << "  vertex pool: " << poolBytes / ( 1024.0 * 1024.0 ) << " MB" << std::endl;
+    std::cout << "  compact vertex pool: " << compactBytes / ( 1024.0 * 1024.0 ) << " MB (x" << static_cast<double>( poolBytes ) / compactBytes
+              << ", max. vertex error " << maxError << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int main( int argc, char **argv )
+{
+    if ( argc < 2 ) usage();
+
+    const std::string benchmark = argv[1];
+    const std::string fileName = argc > 2 ? argv[2] : LIBCITYGML_BENCHMARK_DATA;
+
+    if ( benchmark == "numbers" ) {
+        return benchmarkNumbers( readFile( fileName ) );
+    } else if ( benchmark == "fastpath" ) {
+        return benchmarkFastPath( fileName );
+    } else if ( benchmark == "tesselators" ) {
+        std::vector<std::string> fileNames( argv + 2, argv + argc );
+        if ( fileNames.empty() ) {
+            fileNames.push_back( fileName );
+        }
+        return benchmarkTesselators( fileNames );
+    } else if ( benchmark == "nodenames" ) {
+        std::vector<std::string> fileNames( argv + 2, argv + argc );
+        if ( fileNames.empty() ) {
+            fileNames.push_back( fileName );
+        }
+        return benchmarkNodeNames( fileNames );
+    } else if ( benchmark == "arena" ) {
+        return benchmarkArena( argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 20000 );
+    } else if ( benchmark == "pools" ) {
+        return benchmarkPools( argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 20000 );
+    }
+
+    usage();
+    return EXIT_FAILURE;
+}
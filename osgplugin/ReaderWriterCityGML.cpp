@@ -363,7 +363,7 @@ void createOsgGeometryFromCityGMLGeometry(const citygml::Geometry& geometry, Cit
     {
         const citygml::Polygon& p = *geometry.getPolygon(j);
 
-        if ( p.getIndices().size() == 0 ) continue;
+        if ( p.getIndexCount() == 0 ) continue;
 
         // Geometry management
 
@@ -373,11 +373,11 @@ void createOsgGeometryFromCityGMLGeometry(const citygml::Geometry& geometry, Cit
 
         // Vertices
         osg::Vec3Array* vertices = new osg::Vec3Array;
-        const std::vector<TVec3d>& vert = p.getVertices();
-        vertices->reserve( vert.size() );
-        for ( unsigned int k = 0; k < vert.size(); k++ )
+        // getVertex and getIndex work for the own lists and for (compact) vertex pools
+        vertices->reserve( p.getVertexCount() );
+        for ( size_t k = 0; k < p.getVertexCount(); k++ )
         {
-            TVec3d v = vert[k];
+            TVec3d v = p.getVertex( k );
             osg::Vec3d pt = osg::Vec3d( v.x, v.y, v.z ) - offset;
             vertices->push_back( pt );
         }
@@ -385,7 +385,12 @@ void createOsgGeometryFromCityGMLGeometry(const citygml::Geometry& geometry, Cit
         geom->setVertexArray( vertices );
 
         // Indices
-        osg::DrawElementsUInt* indices = new osg::DrawElementsUInt( osg::PrimitiveSet::TRIANGLES, p.getIndices().begin(), p.getIndices().end());
+        osg::DrawElementsUInt* indices = new osg::DrawElementsUInt( osg::PrimitiveSet::TRIANGLES );
+        indices->reserve( p.getIndexCount() );
+        for ( size_t k = 0; k < p.getIndexCount(); k++ )
+        {
+            indices->push_back( p.getIndex( k ) );
+        }
         geom->addPrimitiveSet( indices );
 
         // Appearance
@@ -8,7 +8,7 @@ namespace citygml {
     class LIBCITYGML_EXPORT Address: public Object
     {
     public:
-        Address(const std::string& id);
+        Address(const ObjectID& id);
 
         const std::string& country() const;
         void setCountry(const std::string& country);
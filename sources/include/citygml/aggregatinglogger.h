@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <citygml/citygml_api.h>
+#include <citygml/citygmllogger.h>
+
+namespace citygml {
+
+    /**
+     * @brief The AggregatingLogger class counts the warnings of each CityGMLLogger::WARNINGTYPE and keeps the first few of them as examples
+     *
+     * All other messages are passed to the wrapped logger immediately. The warnings of a type are only formatted as long as the number of
+     * examples is not reached, afterwards they are only counted. The summary can be retrieved with getWarningCount and getWarningExamples or
+     * passed to the wrapped logger with logSummary (see ParserParams::aggregateWarnings).
+     *
+     * The class is thread safe as long as the wrapped logger is thread safe.
+     */
+    class LIBCITYGML_EXPORT AggregatingLogger : public CityGMLLogger {
+    public:
+        /**
+         * @param logger the logger the messages and the summary are passed to
+         * @param maxExamples the number of warnings that are kept for each warning type
+         */
+        AggregatingLogger(std::shared_ptr<CityGMLLogger> logger, unsigned int maxExamples = 5);
+
+        virtual void log(LOGLEVEL level, const std::string& message, const char* file=nullptr, int line=-1) const override;
+
+        virtual bool isEnabledFor(LOGLEVEL level) const override;
+        virtual LOGLEVEL getLogLevel() const override;
+        virtual LOGLEVEL setLogLevel(LOGLEVEL level) override;
+
+        virtual bool acceptWarning(WARNINGTYPE type) const override;
+        virtual void logWarning(WARNINGTYPE type, const std::string& message, const char* file=nullptr, int line=-1) const override;
+
+        /**
+         * @brief the number of warnings of the type reported so far
+         */
+        uint64_t getWarningCount(WARNINGTYPE type) const;
+
+        /**
+         * @brief the first warnings of the type (at most maxExamples)
+         */
+        std::vector<std::string> getWarningExamples(WARNINGTYPE type) const;
+
+        /**
+         * @brief passes one warning message per reported warning type with the number of warnings and the examples to the wrapped logger
+         */
+        void logSummary() const;
+
+        /**
+         * @brief a short description of the warning type
+         */
+        static const char* getWarningTypeName(WARNINGTYPE type);
+
+    private:
+        std::shared_ptr<CityGMLLogger> m_logger;
+        unsigned int m_maxExamples;
+
+        mutable std::atomic<uint64_t> m_warningCounts[static_cast<int>(WARNINGTYPE::WT_COUNT)];
+
+        mutable std::mutex m_examplesMutex;
+        mutable std::vector<std::string> m_warningExamples[static_cast<int>(WARNINGTYPE::WT_COUNT)];
+    };
+
+}
@@ -40,7 +40,7 @@ namespace citygml {
         virtual ~Appearance() {}
 
     protected:
-        Appearance( const std::string& id, const std::string& typeString );
+        Appearance( const ObjectID& id, const std::string& typeString );
         std::string m_typeString;
         std::vector<std::string> m_themes;
         bool m_isFront;
@@ -7,8 +7,9 @@
 
 #include <citygml/object.h>
 #include <citygml/vecs.hpp>
+#include <citygml/documentposition.h>
 
-class Tesselator;
+class TesselatorBase;
 
 namespace citygml {
 
@@ -44,8 +45,11 @@ namespace citygml {
         void addAppearanceTarget(AppearanceTarget* target);
 
         void addAppearance(std::shared_ptr<Appearance> appearance);
-        void addTextureTargetDefinition(std::shared_ptr<TextureTargetDefinition> targetDef);
-        void addMaterialTargetDefinition(std::shared_ptr<MaterialTargetDefinition> targetDef);
+        /**
+         * @param position the location of the target definition, reported if the target does not exist
+         */
+        void addTextureTargetDefinition(std::shared_ptr<TextureTargetDefinition> targetDef, const DocumentPosition& position);
+        void addMaterialTargetDefinition(std::shared_ptr<MaterialTargetDefinition> targetDef, const DocumentPosition& position);
 
         /**
          * @brief assigns each appearance to all targets for which a coresponding AppearanceTargetDefinition exits.
@@ -53,16 +57,42 @@ namespace citygml {
          */
         void assignAppearancesToTargets();
 
+        /**
+         * @brief assigns the appearances of the AppearanceTargetDefinitions parsed so far to the given targets and forgets the targets
+         * @note used to hand out objects before the document is completely parsed. AppearanceTargetDefinitions that are parsed afterwards
+         *       can not be assigned to the targets.
+         */
+        void assignAppearancesToTargets(const std::vector<AppearanceTarget*>& targets);
+
+        /**
+         * @brief takes over the appearances, targets and AppearanceTargetDefinitions of other (which is empty afterwards)
+         *
+         * Used to combine the managers of document chunks that are parsed independently. Objects of other replace objects with
+         * the same id, as if other's document chunk was parsed behind this one.
+         */
+        void merge(AppearanceManager& other);
+
 
     protected:
+        struct TargetDefinitions {
+            std::vector<std::shared_ptr<MaterialTargetDefinition> > materialTargetDefinitions;
+            std::vector<std::shared_ptr<TextureTargetDefinition> > texTargetDefinitions;
+            // the location of the first target definition of the target
+            DocumentPosition position;
+        };
+
         std::unordered_map<std::string, std::shared_ptr<Appearance> > m_appearancesMap;
-        std::vector<std::shared_ptr<MaterialTargetDefinition> > m_materialTargetDefinitions;
-        std::vector<std::shared_ptr<TextureTargetDefinition> > m_texTargetDefinitions;
+        // the pending target definitions by target id
+        std::unordered_map<std::string, TargetDefinitions> m_targetDefinitions;
+        size_t m_materialTargetDefinitionsCount;
+        size_t m_texTargetDefinitionsCount;
         std::unordered_set<std::string> m_themes;
         std::unordered_map<std::string, AppearanceTarget*> m_appearanceTargetsMap;
         std::shared_ptr<CityGMLLogger> m_logger;
 
         void addThemesFrom(std::shared_ptr<Appearance> surfaceData);
+        void assignTargetDefinitions(TargetDefinitions& targetDefinitions, AppearanceTarget* target);
+        TargetDefinitions& getTargetDefinitions(const std::string& targetID, const DocumentPosition& position);
     };
 
 }
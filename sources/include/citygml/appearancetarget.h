@@ -38,8 +38,13 @@ namespace citygml {
 
         std::vector<std::string> getAllTextureThemes(bool front) const;
 
+        /**
+         * @brief returns true if both targets have the same textures and materials (not only equal ones) for every theme and side
+         */
+        bool hasSameAppearancesAs(const AppearanceTarget& other) const;
+
     protected:
-        AppearanceTarget(const std::string& id);
+        AppearanceTarget(const ObjectID& id);
 
 
 
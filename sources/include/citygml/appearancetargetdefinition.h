@@ -25,7 +25,7 @@ namespace citygml {
     template<class T>
     class AppearanceTargetDefinition : public Object {
     public:
-        AppearanceTargetDefinition(const std::string& targetID, std::shared_ptr<T> appearance, const std::string& id) : Object(id), m_targetID(targetID), m_appearance(appearance) {}
+        AppearanceTargetDefinition(const std::string& targetID, std::shared_ptr<T> appearance, const ObjectID& id) : Object(id), m_targetID(targetID), m_appearance(appearance) {}
 
         /**
          * @brief the id of the target surface
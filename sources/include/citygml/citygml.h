@@ -33,7 +33,7 @@
 #include <citygml/envelope.h>
 
 
-class Tesselator;
+class TesselatorBase;
 
 namespace citygml
 {
@@ -43,9 +43,16 @@ namespace citygml
     class Texture;
     class Material;
     class AppearanceManager;
+    class LoadStatistics;
 
     typedef EnumClassBitmask<CityObject::CityObjectsType> CityObjectsTypeMask;
 
+    enum class TesselatorType
+    {
+        GLU,
+        EarClipping
+    };
+
 
     ///////////////////////////////////////////////////////////////////////////////
     // Parsing routines
@@ -53,11 +60,45 @@ namespace citygml
     // Parameters:
     // objectsMask: a bit mask that defines which CityObjectsTypes are parsed
     //    examples: CityObject::CityObjectsType::COT_Building | CityObject::CityObjectsType::COT_Room <- parses only Building and Room objects"
+    //    note: the mask is applied to every CityObject including nested ones (e.g. BuildingParts or boundary surfaces like WallSurface).
+    //          Objects that do not match the mask are skipped with all their children at parse time.
     // minLOD: the minimal LOD that will be parsed
     // maxLOD: the maximal LOD that will be parsed
-    // optimize: merge geometries & polygons that share the same appearance in the same object in order to reduce the global hierarchy
+    // optimize: merge geometries & polygons that share the same appearance in the same object in order to reduce the global hierarchy.
+    //    The finished polygons of a CityObject with the same LOD and the same textures and materials for every theme are replaced by one polygon
+    //    (see CityObject::mergePolygons), duplicate vertices of the rings are removed before tesselation (default: false)
     // pruneEmptyObjects: remove the objects which do not contains any geometrical entity
     // tesselate: convert the interior & exteriors polygons to triangles
+    // tesselatorType: the tesselator used to triangulate the polygons. TesselatorType::GLU (default) uses the GLU tesselator,
+    //    TesselatorType::EarClipping uses a built-in ear clipping tesselator that does not create new vertices
+    // threadCount: the number of threads used to tesselate the polygons after parsing, 0 uses one thread per hardware thread (default: 1)
+    //    note: if more than one thread is used the logger must be thread safe
+    // parserThreadCount: the number of threads used to parse a file loaded with load(fileName, ...), 0 uses one thread per hardware thread (default: 1)
+    //    The content of the CityModel is split in front of cityObjectMember elements into chunks that are parsed independently and merged afterwards.
+    //    Documents that can not be split (small files, documents in UTF-16 or with surfaceDataMember xlinks) are parsed by a single thread.
+    //    note: if more than one thread is used the logger must be thread safe
+    // compactIDs: objects without gml:id get compact generated ids (document index and ordinal) instead of "genID_<file>_<line>_<column>" strings
+    //    (default: false). The string form "genID_<document>_<ordinal>" is only created when getId is called. Such objects are not registered
+    //    for xlink and appearance resolution as no element of the document can reference them.
+    // aggregateWarnings: the warnings that may be reported very often for a document (see CityGMLLogger::WARNINGTYPE) are counted and only the first
+    //    maxWarningExamples warnings of each type are formatted. A summary is passed to the logger at the end of the document (default: false).
+    //    note: pass an AggregatingLogger as logger to retrieve the summary programmatically instead
+    // maxWarningExamples: the number of warnings of each type that are kept as examples if aggregateWarnings is set (default: 5)
+    // statistics: if not null the load call fills the object with the time spent in the different phases of the load call and with the numbers of
+    //    elements, objects, polygons and xlinks (default: nullptr). The object must be valid until the load call returns.
+    // objectArena: the objects of the model are placed in large memory blocks (see ObjectArena) that are released at once when the model and all
+    //    objects taken from it are destroyed (default: false). Speeds up the teardown of large models and keeps the heap of long running
+    //    processes from fragmenting.
+    // vertexPools: after the model is finished the vertices, indices and texture coordinates of all polygons are moved into one VertexPool of the
+    //    CityModel (default: false). Polygon::getVertices and Polygon::getIndices return empty lists in that case, use Polygon::getVertexSpan,
+    //    Polygon::getIndexSpan and Polygon::getTexCoordSpanForTheme instead. Has no effect on CityObjects passed to the callback of streamCityObjects.
+    // compactVertices: like vertexPools but the vertices are stored as float offsets from a double precision origin per root CityObject and the
+    //    indices of polygons with less than 65536 vertices as 16 bit values (default: false). Roughly halves the memory of the geometry.
+    //    Use Polygon::getLocalVertexSpan with Polygon::getVertexOrigin and Polygon::getShortIndexSpan, or Polygon::getVertex and Polygon::getIndex.
+    // weldVertices: after the model is finished the polygons of every geometry are merged into indexed meshes whose adjacent faces share their
+    //    vertices, one mesh per combination of textures and materials (default: false). See Geometry::getWeldedMeshes and WeldedMesh.
+    // weldTolerance: vertices whose coordinates differ by at most this distance are welded, in units of the (destination) SRS (default: 1e-6).
+    //    Vertices are only welded if their texture coordinates are equal.
     // destSRS: the SRS (WKT, EPSG, OGC URN, etc.) where the coordinates must be transformed, default ("") is no transformation
 
     class ParserParams
@@ -71,6 +112,18 @@ namespace citygml
             , pruneEmptyObjects( false )
             , destSRS( "" )
             , keepVertices ( false )
+            , tesselatorType( TesselatorType::GLU )
+            , threadCount( 1 )
+            , parserThreadCount( 1 )
+            , compactIDs( false )
+            , aggregateWarnings( false )
+            , maxWarningExamples( 5 )
+            , statistics( nullptr )
+            , objectArena( false )
+            , vertexPools( false )
+            , compactVertices( false )
+            , weldVertices( false )
+            , weldTolerance( 1e-6 )
         { }
 
     public:
@@ -81,6 +134,18 @@ namespace citygml
         bool pruneEmptyObjects;
         bool tesselate;
         bool keepVertices;
+        TesselatorType tesselatorType;
+        unsigned int threadCount;
+        unsigned int parserThreadCount;
+        bool compactIDs;
+        bool aggregateWarnings;
+        unsigned int maxWarningExamples;
+        LoadStatistics* statistics;
+        bool objectArena;
+        bool vertexPools;
+        bool compactVertices;
+        bool weldVertices;
+        double weldTolerance;
         std::string destSRS;
     };
 
@@ -88,4 +153,44 @@ namespace citygml
 
     LIBCITYGML_EXPORT std::shared_ptr<const CityModel> load( const std::string& fileName, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger = nullptr);
 
+    /**
+     * @brief loads a CityGML document from a caller owned buffer
+     *
+     * The buffer is parsed in place (it is not copied) and must stay valid until the function returns.
+     * @param data the document (the encoding is detected by the xml parser)
+     * @param size the size of the document in bytes
+     */
+    LIBCITYGML_EXPORT std::shared_ptr<const CityModel> load( const char* data, size_t size, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger = nullptr);
+
+    /**
+     * @brief loads a CityGML file by mapping it into memory instead of reading it through a file stream
+     *
+     * The file is parsed directly from the mapping and unmapped before the function returns.
+     * @note load(fileName, ...) maps the file as well if parserThreadCount is greater than one
+     */
+    LIBCITYGML_EXPORT std::shared_ptr<const CityModel> loadMemoryMapped( const std::string& fileName, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Streaming routines
+    //
+    // The top level CityObjects (the cityObjectMembers of the CityModel) are passed to the callback as soon as they are parsed instead
+    // of being added to the CityModel. The objects are finished (tesselated) and transformed to destSRS. The callback takes the
+    // ownership of the object, hence only the objects currently parsed must be kept in memory.
+    // The returned CityModel contains no root CityObjects (but its id, envelope, srs name and themes).
+    //
+    // Deferral policy:
+    // - An object that references polygons (xlinks) or shared implicit geometries that are not parsed yet, or whose polygons are
+    //   referenced by such an object, is deferred. Deferred objects are passed to the callback after the whole document is parsed
+    //   in document order.
+    // - References to polygons of objects that were already passed to the callback can not be resolved.
+    // - Appearances (e.g. global appearanceMembers of the CityModel) are assigned to an object if they are parsed before the object is passed
+    //   to the callback. Appearances that target objects that were already passed to the callback are ignored, hence documents that
+    //   contain their global appearances at the end should be loaded with citygml::load if the appearances are required.
+
+    typedef std::function<void (std::unique_ptr<CityObject> obj)> CityObjectCallback;
+
+    LIBCITYGML_EXPORT std::shared_ptr<const CityModel> streamCityObjects( std::istream& stream, const ParserParams& params, CityObjectCallback callback, std::shared_ptr<CityGMLLogger> logger = nullptr);
+
+    LIBCITYGML_EXPORT std::shared_ptr<const CityModel> streamCityObjects( const std::string& fileName, const ParserParams& params, CityObjectCallback callback, std::shared_ptr<CityGMLLogger> logger = nullptr);
+
 }
@@ -2,6 +2,7 @@
 
 #include <citygml/geometry.h>
 #include <citygml/cityobject.h>
+#include <citygml/documentposition.h>
 
 #include <memory>
 
@@ -11,6 +12,7 @@ namespace citygml {
     class PolygonManager;
     class GeometryManager;
     class CityGMLLogger;
+    class ObjectArena;
 
     class CityModel;
     class AppearanceTarget;
@@ -18,6 +20,7 @@ namespace citygml {
     class Geometry;
     class ImplicitGeometry;
     class Polygon;
+    class LinearRing;
     class LineString;
 
     class Appearance;
@@ -30,38 +33,82 @@ namespace citygml {
 
     class CityGMLFactory {
     public:
-        CityGMLFactory(std::shared_ptr<CityGMLLogger> logger);
+        /**
+         * @param useObjectArena if true the created objects are placed in an ObjectArena of the factory (see ParserParams::objectArena)
+         */
+        CityGMLFactory(std::shared_ptr<CityGMLLogger> logger, bool useObjectArena = false);
 
-        CityModel* createCityModel(const std::string& id);
-        CityObject* createCityObject(const std::string& id, CityObject::CityObjectsType type);
-        Geometry* createGeometry(const std::string& id, const CityObject::CityObjectsType& cityObjType = CityObject::CityObjectsType::COT_All, unsigned int lod = 0);
+        CityModel* createCityModel(const ObjectID& id);
+        CityObject* createCityObject(const ObjectID& id, CityObject::CityObjectsType type);
+        Geometry* createGeometry(const ObjectID& id, const CityObject::CityObjectsType& cityObjType = CityObject::CityObjectsType::COT_All, unsigned int lod = 0);
 
-        std::shared_ptr<Polygon> createPolygon(const std::string& id);
-        std::shared_ptr<LineString> createLineString(const std::string& id);
+        std::shared_ptr<Polygon> createPolygon(const ObjectID& id);
+        LinearRing* createLinearRing(const ObjectID& id, bool isExterior);
+        std::shared_ptr<LineString> createLineString(const ObjectID& id);
 
         /**
          * @brief requests a polygon for a Geometry object that will be added later
          * @param geom the Geometry object to which the polygon will be added
          * @param polygonId the id of the polygon
+         * @param position the location of the xlink, reported if the polygon does not exist
          */
-        void requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonId);
+        void requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonId, const DocumentPosition& position);
 
-        ImplicitGeometry* createImplictGeometry(const std::string& id);
+        ImplicitGeometry* createImplictGeometry(const ObjectID& id);
         std::shared_ptr<Geometry> shareGeometry(Geometry* geom);
-        void requestSharedGeometryWithID(ImplicitGeometry* implicitGeom, const std::string& id);
+        void requestSharedGeometryWithID(ImplicitGeometry* implicitGeom, const std::string& id, const DocumentPosition& position);
 
-        std::shared_ptr<Texture> createTexture(const std::string& id);
-        std::shared_ptr<Material> createMaterial(const std::string& id);
-        std::shared_ptr<GeoreferencedTexture> createGeoReferencedTexture(const std::string& id);
+        std::shared_ptr<Texture> createTexture(const ObjectID& id);
+        std::shared_ptr<Material> createMaterial(const ObjectID& id);
+        std::shared_ptr<GeoreferencedTexture> createGeoReferencedTexture(const ObjectID& id);
 
-        std::shared_ptr<MaterialTargetDefinition> createMaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const std::string& id);
-        std::shared_ptr<TextureTargetDefinition> createTextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const std::string& id);
+        /**
+         * @param position the location of the target definition, reported if the target does not exist
+         */
+        std::shared_ptr<MaterialTargetDefinition> createMaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const ObjectID& id, const DocumentPosition& position);
+        std::shared_ptr<TextureTargetDefinition> createTextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const ObjectID& id, const DocumentPosition& position);
 
         std::shared_ptr<Appearance> getAppearanceWithID(const std::string& id);
         std::vector<std::string> getAllThemes();
 
+        /**
+         * @brief resolves the shared polygons and geometries and assigns the appearances of a top level CityObject whose parsing has finished
+         *
+         * Used to hand out CityObjects before the whole document is parsed. Afterwards the factory holds no references to the
+         * polygons and geometries of the object, except for shared geometries of implicit geometries. Appearances parsed after this call
+         * can not be assigned to the object.
+         * @return false if the object references polygons or shared geometries that are not known yet or one of its polygons is
+         *         referenced by a previously deferred object. The object is deferred in that case, i.e. it is resolved by closeFactory.
+         */
+        bool closeCityObject(CityObject& obj);
+
+        /**
+         * @brief takes over the shared polygons and geometries, the appearances and all pending requests of another factory
+         *
+         * Used to combine the factories of document chunks that are parsed independently before closeFactory is called.
+         * The objects of other replace objects with the same id, as if other's chunk was parsed behind the chunk of this factory.
+         */
+        void mergeFactory(CityGMLFactory& other);
+
+        /**
+         * @brief moves the root CityObjects of other to the end of the root CityObjects of model
+         *
+         * The envelope and the attributes of other are taken over if model does not define them.
+         */
+        void mergeCityModels(CityModel& model, CityModel& other);
+
         void closeFactory();
 
+        /**
+         * @brief the number of polygon and geometry xlinks that were resolved so far
+         */
+        size_t getResolvedXLinksCount() const;
+
+        /**
+         * @brief the number of polygon and geometry xlinks that could not be resolved by closeFactory
+         */
+        size_t getUnresolvedXLinksCount() const;
+
         ~CityGMLFactory();
     protected:
         void appearanceTargetCreated(AppearanceTarget* obj);
@@ -70,6 +117,8 @@ namespace citygml {
         std::unique_ptr<AppearanceManager> m_appearanceManager;
         std::unique_ptr<PolygonManager> m_polygonManager;
         std::unique_ptr<GeometryManager> m_geometryManager;
+        // nullptr if the objects are allocated on the heap, the factory holds a reference
+        ObjectArena* m_arena;
     };
 
 }
@@ -16,6 +16,24 @@ namespace citygml {
             LL_TRACE = 0
         };
 
+        /**
+         * @brief types of warnings that may be reported very often for a single document (e.g. once per polygon)
+         */
+        enum class WARNINGTYPE {
+            WT_UNKNOWN_ELEMENT = 0,
+            WT_UNEXPECTED_ELEMENT,
+            WT_RING_TOO_FEW_VERTICES,
+            WT_POLYGON_TOO_FEW_VERTICES,
+            WT_TEXTURE_COORDINATES_MISMATCH,
+            WT_MISSING_APPEARANCE_TARGET,
+            WT_UNRESOLVED_POLYGON_XLINK,
+            WT_UNRESOLVED_GEOMETRY_XLINK,
+            WT_DUPLICATE_ID,
+            WT_MISSING_SRS,
+            WT_TESSELATION_FAILED,
+            WT_COUNT
+        };
+
         CityGMLLogger(LOGLEVEL level = LOGLEVEL::LL_ERROR):m_logLevel(level){}
 
         /**
@@ -34,26 +52,81 @@ namespace citygml {
         virtual LOGLEVEL setLogLevel(LOGLEVEL level) {
             return m_logLevel = level;
         };
+
+        /**
+         * @brief returns wether a warning of the given type is formatted and passed to logWarning. Might be called from different threads.
+         *
+         * Loggers that aggregate warnings (see AggregatingLogger) count the warnings here and only accept the first few of each type.
+         */
+        virtual bool acceptWarning(WARNINGTYPE type) const {
+            (void)type;
+            return isEnabledFor(LOGLEVEL::LL_WARNING);
+        };
+
+        /**
+         * @brief logs a warning of the given type that was accepted by acceptWarning. Might be called from different threads.
+         */
+        virtual void logWarning(WARNINGTYPE type, const std::string& message, const char* file=nullptr, int line=-1) const {
+            (void)type;
+            log(LOGLEVEL::LL_WARNING, message, file, line);
+        };
+
+        virtual ~CityGMLLogger() {}
     private:
 
         LOGLEVEL m_logLevel;
     };
 
     /**
-      * @brief logs a message for a certain log level
+      * @brief the lowest log level (as int) that is compiled into the library (see CMake option LIBCITYGML_MIN_LOG_LEVEL)
+      *
+      * Messages below this level are removed by the compiler and are never passed to a logger.
+      */
+    #ifndef LIBCITYGML_MIN_LOG_LEVEL
+    #define LIBCITYGML_MIN_LOG_LEVEL 0
+    #endif
+
+    #define CITYGML_LOG_LEVEL_COMPILED_IN(level) (static_cast<int>(level) >= LIBCITYGML_MIN_LOG_LEVEL)
+
+    /**
+      * @brief logs a message for a certain log level if enabled is true
+      * @param enabled an expression that tells whether the level is enabled, e.g. a cached result of CityGMLLogger::isEnabledFor
       * @param logger a pointer to a CityGMLLogger
       * @param level the CityGMLLogger::LOGLEVEL
       * @param message a string or a stream expression
       */
-    #define CITYGML_LOG(logger, level, message)                             \
+    #define CITYGML_LOG_IF(enabled, logger, level, message)                 \
         do {                                                                \
-            if (logger->isEnabledFor(level)) {                              \
+            if (CITYGML_LOG_LEVEL_COMPILED_IN(level) && (enabled)) {        \
                 std::stringstream ss;                                       \
                 ss << message;                                              \
                 logger->log(level, ss.str(), __FILE__,  __LINE__);          \
             }                                                               \
         } while (0);
 
+    /**
+      * @brief logs a message for a certain log level
+      * @param logger a pointer to a CityGMLLogger
+      * @param level the CityGMLLogger::LOGLEVEL
+      * @param message a string or a stream expression
+      */
+    #define CITYGML_LOG(logger, level, message) CITYGML_LOG_IF(logger->isEnabledFor(level), logger, level, message)
+
+
+    /**
+      * @brief logs a warning of a certain CityGMLLogger::WARNINGTYPE (see CityGMLLogger::acceptWarning)
+      * @param logger a pointer to a CityGMLLogger
+      * @param type the CityGMLLogger::WARNINGTYPE
+      * @param message a string or a stream expression
+      */
+    #define CITYGML_LOG_WARN_TYPE(logger, type, message)                                                                \
+        do {                                                                                                            \
+            if (CITYGML_LOG_LEVEL_COMPILED_IN(citygml::CityGMLLogger::LOGLEVEL::LL_WARNING) && logger->acceptWarning(type)) { \
+                std::stringstream ss;                                                                                   \
+                ss << message;                                                                                          \
+                logger->logWarning(type, ss.str(), __FILE__,  __LINE__);                                                \
+            }                                                                                                           \
+        } while (0);
 
     #define CITYGML_LOG_ERROR(logger, message) CITYGML_LOG(logger, citygml::CityGMLLogger::LOGLEVEL::LL_ERROR, message)
     #define CITYGML_LOG_WARN(logger, message) CITYGML_LOG(logger, citygml::CityGMLLogger::LOGLEVEL::LL_WARNING, message)
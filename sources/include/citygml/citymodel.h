@@ -15,6 +15,7 @@ namespace citygml {
     class CityGMLLogger;
     class CityObject;
     class CityGMLFactory;
+    class VertexPool;
 
     typedef std::vector<std::unique_ptr<CityObject> > CityObjects;
     typedef std::vector<const CityObject*> ConstCityObjects;
@@ -39,7 +40,39 @@ namespace citygml {
 
         const std::string& getSRSName() const;
 
-        void finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger);
+        /**
+         * @brief finishes (tesselates) all city objects of the model
+         * @param tesselator the tesselator used to tesselate the polygons. Additional threads use clones of the tesselator.
+         * @param threadCount the number of threads that tesselate the polygons (including the calling thread), 0 uses one thread per hardware thread
+         * @note the logger must be thread safe if more than one thread is used
+         */
+        void finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger, unsigned int threadCount = 1);
+
+        /**
+         * @brief moves the vertices, indices and texture coordinates of all (finished) polygons into one VertexPool
+         *
+         * Afterwards Polygon::getVertices and Polygon::getIndices return empty lists, the data is accessed with Polygon::getVertexSpan,
+         * Polygon::getIndexSpan and Polygon::getTexCoordSpanForTheme or for the whole model with getVertexPool.
+         * @param compact if true the vertices are stored as single precision offsets from an origin per root CityObject and the indices
+         *        of polygons with less than 65536 vertices as 16 bit values (see Polygon::getLocalVertexSpan and Polygon::getShortIndexSpan)
+         * @note calling the method again does nothing
+         */
+        void createVertexPool(bool compact = false);
+
+        /**
+         * @brief the pool that holds the vertices of all polygons or nullptr if createVertexPool was not called
+         */
+        std::shared_ptr<const VertexPool> getVertexPool() const;
+        std::shared_ptr<VertexPool> getVertexPool();
+
+        /**
+         * @brief welds the vertices of the geometries of all (finished) city objects into indexed meshes
+         *
+         * The polygons of every geometry of a CityObject (including its child geometries) are merged into one mesh per combination of
+         * the textures and materials of the themes of the model, see Geometry::getWeldedMeshes.
+         * @param tolerance vertices whose coordinates differ by at most tolerance are merged
+         */
+        void createWeldedMeshes(double tolerance);
 
         std::vector<std::string> themes() const;
         void setThemes(std::vector<std::string> themes);
@@ -48,7 +81,7 @@ namespace citygml {
 
     protected:
 
-        CityModel( const std::string& id = "CityModel");
+        CityModel( const ObjectID& id = "CityModel");
 
         void addToCityObjectsMapRecursive(const CityObject* cityObj);
 
@@ -59,6 +92,8 @@ namespace citygml {
         std::string m_srsName;
 
         std::vector<std::string> m_themes;
+
+        std::shared_ptr<VertexPool> m_vertexPool;
     };
 
     std::ostream& operator<<( std::ostream&, const citygml::CityModel & );
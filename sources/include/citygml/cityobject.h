@@ -6,12 +6,13 @@
 #include <citygml/featureobject.h>
 #include <citygml/citygml_api.h>
 #include <citygml/enum_type_bitmask.h>
-class Tesselator;
+class TesselatorBase;
 
 namespace citygml {
 
     class ParserParams;
     class Geometry;
+    class Polygon;
     class ImplicitGeometry;
     class Composite;
     class CityGMLLogger;
@@ -68,7 +69,7 @@ namespace citygml {
         
         
         
-        CityObject( const std::string& id, CityObjectsType type );
+        CityObject( const ObjectID& id, CityObjectsType type );
 
         // Get the object type
         CityObjectsType getType() const;
@@ -103,7 +104,30 @@ namespace citygml {
         const Address* address() const;
         void setAddress(std::unique_ptr<Address>&& address);
 
-        void finish(Tesselator& tesselator, bool optimize, std::shared_ptr<citygml::CityGMLLogger> logger);
+        void finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<citygml::CityGMLLogger> logger);
+
+        /**
+         * @brief prepares the geometries of this object and all child objects for finishing and appends their polygons to polygons
+         * @see Geometry::prepareFinish
+         */
+        void prepareFinish(std::vector<Polygon*>& polygons);
+
+        /**
+         * @brief merges the finished polygons of this object that have the same LOD and the same appearances (see ParserParams::optimize)
+         *
+         * The polygons of the geometries of the object (including child geometries) are grouped by the LOD of their geometry and by their
+         * textures and materials. Every group is replaced by one merged polygon in the geometry of its first polygon (see Polygon::merge).
+         * Polygons without triangles and implicit geometries (shared between objects) are not merged. The child objects are merged as well,
+         * each on its own.
+         * @note geometries may be empty afterwards
+         */
+        void mergePolygons(std::shared_ptr<CityGMLLogger> logger);
+
+        /**
+         * @brief welds the vertices of the geometries (including implicit geometries) of this object and all child objects
+         * @see Geometry::createWeldedMeshes
+         */
+        void createWeldedMeshes(const std::vector<std::string>& themes, double tolerance);
 
         virtual ~CityObject();
 
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace citygml {
+
+    /**
+     * @brief The DocumentPosition struct is the line and column of an element
+     *
+     * Kept by the factory for references that are resolved after parsing (xlinks, appearance targets) in order to report the location
+     * of unresolved references (see DocumentLocation for the location of the current element).
+     */
+    struct DocumentPosition {
+        DocumentPosition(uint64_t line = 0, uint64_t column = 0) : line(line), column(column) {}
+
+        uint64_t line;
+        uint64_t column;
+    };
+
+    inline std::ostream& operator<<( std::ostream& os, const DocumentPosition& o ) {
+
+        if (o.line == 0) {
+            os << " unknown location";
+        } else {
+            os << " line " << o.line;
+
+            if (o.column > 0) {
+                os << ", column " << o.column;
+            }
+        }
+
+        return os;
+    }
+}
@@ -0,0 +1,106 @@
+/* -*-c++-*- libcitygml
+*
+* This file is part of libcitygml library
+* http://code.google.com/p/libcitygml
+*
+* libcitygml is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 2.1 of the License, or
+* (at your option) any later version.
+*
+* libcitygml is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* The ear clipping algorithm is a port of earcut (https://github.com/mapbox/earcut), which is distributed under the
+* following license:
+*
+* ISC License
+*
+* Copyright (c) 2016, Mapbox
+*
+* Permission to use, copy, modify, and/or distribute this software for any purpose
+* with or without fee is hereby granted, provided that the above copyright notice
+* and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH REGARD TO
+* THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+* IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+* DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+* WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#pragma once
+
+#include <citygml/tesselatorbase.h>
+
+/**
+ * @brief Ear clipping polygon tesselator that does not depend on GLU
+ *
+ * The contours are projected on the plane orthogonal to the dominant axis of the polygon normal. Interior rings are
+ * merged into the exterior ring by bridges (Eberly, D. 2008. Triangulation by Ear Clipping) and the resulting ring
+ * is triangulated by ear clipping. Self intersecting rings are handled by curing local intersections and by splitting
+ * the ring along valid diagonals if no ear can be found.
+ *
+ * Unlike the GLU tesselator no vertices are created (the bridges reference the existing vertices), hence the texture
+ * coordinates of the result are the texture coordinates of the contours.
+ *
+ * Every instance is independent of all others, so different instances can be used concurrently.
+ */
+class EarClippingTesselator : public TesselatorBase
+{
+public:
+    EarClippingTesselator( std::shared_ptr<citygml::CityGMLLogger> logger );
+    ~EarClippingTesselator();
+
+    // Let's tesselate!
+    void compute() override;
+
+    std::unique_ptr<TesselatorBase> clone() const override;
+
+private:
+    // Node of the circular doubly linked list of a ring. The links are indices into _nodes.
+    struct Node {
+        unsigned int vertex;
+        double x;
+        double y;
+        int prev;
+        int next;
+    };
+
+    int createRing(unsigned int begin, unsigned int end, bool counterClockwise);
+    int insertNode(unsigned int vertex, int last);
+    void removeNode(int node);
+    int splitPolygon(int a, int b);
+    int filterPoints(int start, int end = -1);
+
+    int getLeftmost(int start) const;
+    int eliminateHoles(int outerNode);
+    int eliminateHole(int hole, int outerNode);
+    int findHoleBridge(int hole, int outerNode);
+
+    void clipEars(int ear, int pass);
+    bool isEar(int ear) const;
+    int cureLocalIntersections(int start);
+    void splitAndClipEars(int start);
+
+    void addTriangle(int a, int b, int c);
+
+    double area(int p, int q, int r) const;
+    bool equals(int p, int q) const;
+    bool intersects(int p1, int q1, int p2, int q2) const;
+    bool intersectsPolygon(int a, int b) const;
+    bool locallyInside(int a, int b) const;
+    bool middleInside(int a, int b) const;
+    bool isValidDiagonal(int a, int b) const;
+    bool sectorContainsSector(int m, int p) const;
+
+    std::vector<Node> _nodes;
+
+    // the projection plane
+    int _axisU;
+    int _axisV;
+    TVec3d _origin;
+};
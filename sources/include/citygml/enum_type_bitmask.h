@@ -18,7 +18,7 @@ public:
     /*constexpr*/ explicit EnumClassBitmask(underlying_type t) : t(T(t)) {}
 
     /*constexpr*/ /*explicit*/ operator bool() const { return bool(t); }
-   /*constexpr*/ operator T() { return t; }
+   /*constexpr*/ operator T() const { return t; }
 
     /*constexpr*/ EnumClassBitmask operator|(T r) const { return EnumClassBitmask(t | r); }
     /*constexpr*/ EnumClassBitmask operator&(T r) const { return EnumClassBitmask(t & r); }
@@ -11,7 +11,7 @@ namespace citygml {
 
     class FeatureObject : public Object {
     public:
-        FeatureObject(const std::string& gmlID);
+        FeatureObject(const ObjectID& gmlID);
 
         const Envelope& getEnvelope() const;
         void setEnvelope(Envelope* e);
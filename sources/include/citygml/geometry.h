@@ -3,11 +3,13 @@
 #include <memory>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <atomic>
 
 #include <citygml/citygml_api.h>
 #include <citygml/appearancetarget.h>
 
-class Tesselator;
+class TesselatorBase;
 
 namespace citygml {
 
@@ -18,6 +20,7 @@ namespace citygml {
     class ParserParams;
     class CityGMLFactory;
     class CityGMLLogger;
+    class WeldedMesh;
 
     class LIBCITYGML_EXPORT Geometry : public AppearanceTarget
     {
@@ -68,15 +71,43 @@ namespace citygml {
          * @param tesselator the tesselator to be used for tesselation
          * @param mergePolygons determines wether all polygons are merged into one
          */
-        void finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger);
+        void finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger);
+
+        /**
+         * @brief broadcasts the appearances of the geometry to all child geometries and polygons and appends the polygons of the geometry
+         *        and its child geometries to polygons. The collected polygons must be finished by the caller.
+         * @note the geometry is marked as finished, hence the polygons of a geometry that is shared by multiple parents are collected once
+         */
+        void prepareFinish(std::vector<Polygon*>& polygons);
+
+        /**
+         * @brief removes the polygons of the geometry (not of its child geometries) that are keys of replacements
+         *
+         * A removed polygon that is mapped to a polygon is replaced by it. The replacement is moved out of the map, hence it is inserted only
+         * once even if the polygon occurs several times. Used to merge the polygons of a CityObject (see CityObject::mergePolygons).
+         */
+        void replacePolygons(std::unordered_map<const Polygon*, std::shared_ptr<Polygon> >& replacements);
+
+        /**
+         * @brief welds the vertices of the finished polygons of the geometry and its child geometries into indexed meshes (see WeldedMesh)
+         * @param themes the themes whose appearances distinguish the meshes
+         * @param tolerance vertices whose coordinates differ by at most tolerance are merged
+         * @note does nothing if the meshes were already created (shared geometries)
+         */
+        void createWeldedMeshes(const std::vector<std::string>& themes, double tolerance);
+
+        /**
+         * @brief the meshes created by createWeldedMeshes, one per combination of appearances (see ParserParams::weldVertices)
+         */
+        const std::vector<std::shared_ptr<const WeldedMesh> >& getWeldedMeshes() const;
 
         ~Geometry();
 
 
     protected:
-        Geometry( const std::string& id, GeometryType type = GeometryType::GT_Unknown, unsigned int lod = 0 );
+        Geometry( const ObjectID& id, GeometryType type = GeometryType::GT_Unknown, unsigned int lod = 0 );
 
-        bool m_finished;
+        std::atomic<bool> m_finished;
 
         GeometryType m_type;
 
@@ -86,6 +117,11 @@ namespace citygml {
 
         std::vector<std::shared_ptr<Polygon> > m_polygons;
         std::vector<std::shared_ptr<LineString> > m_lineStrings;
+
+        void collectPolygons(std::vector<std::shared_ptr<const Polygon> >& polygons) const;
+
+        std::vector<std::shared_ptr<const WeldedMesh> > m_weldedMeshes;
+        std::atomic<bool> m_welded;
     };
 
     std::ostream& operator<<( std::ostream& os, const citygml::Geometry& s );
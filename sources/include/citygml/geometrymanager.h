@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include <citygml/documentposition.h>
+
 namespace citygml {
 
     class ImplicitGeometry;
@@ -21,22 +23,55 @@ namespace citygml {
          * @brief the Geometry with id geometryID will be added to geom when finished is called
          * @param geom the ImplicitGeometry object to which the Geometry object will be added
          * @param geometryID the id of the Geometry
+         * @param position the location of the xlink, reported if the geometry does not exist
+         */
+        void requestSharedGeometryForImplicitGeometry(ImplicitGeometry* geom, const std::string& geometryID, const DocumentPosition& position);
+
+        /**
+         * @brief resolves the requests made since the last call of finishRecentRequests for which the requested geometry is known
+         * @return false if not all requests could be resolved. The remaining requests are resolved when finish is called.
+         * @note shared geometries are kept until finish is called
          */
-        void requestSharedGeometryForImplicitGeometry(ImplicitGeometry* geom, const std::string& geometryID);
+        bool finishRecentRequests();
+
+        /**
+         * @brief takes over the shared geometries and requests of other (which is empty afterwards)
+         *
+         * Used to combine the managers of document chunks that are parsed independently. Geometries of other replace geometries
+         * with the same id, as if other's document chunk was parsed behind this one.
+         */
+        void merge(GeometryManager& other);
 
         void finish();
 
+        /**
+         * @brief the number of requests that were resolved (by finishRecentRequests or finish)
+         */
+        size_t getResolvedRequestsCount() const;
+
+        /**
+         * @brief the number of requests for which finish found no geometry
+         */
+        size_t getUnresolvedRequestsCount() const;
+
         ~GeometryManager();
     private:
         struct GeometryRequest {
-            GeometryRequest(ImplicitGeometry* target, std::string geometryID) : target(target), geometryID(geometryID) {}
+            GeometryRequest(ImplicitGeometry* target, std::string geometryID, const DocumentPosition& position) : target(target), geometryID(geometryID), position(position) {}
             ImplicitGeometry* target;
             std::string geometryID;
+            DocumentPosition position;
         };
 
         std::shared_ptr<CityGMLLogger> m_logger;
         std::vector<GeometryRequest> m_geometryRequests;
         std::unordered_map<std::string, std::shared_ptr<Geometry> > m_sharedGeometries;
+
+        // the requests in front of m_firstRecentRequest are deferred
+        size_t m_firstRecentRequest;
+
+        size_t m_resolvedRequests;
+        size_t m_unresolvedRequests;
     };
 
 }
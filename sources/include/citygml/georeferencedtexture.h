@@ -24,7 +24,7 @@ namespace citygml {
         // TODO support referencePoint and orientation
 
     protected:
-        GeoreferencedTexture( const std::string& id );
+        GeoreferencedTexture( const ObjectID& id );
         bool m_preferWorldFile;
     };
 
@@ -35,7 +35,7 @@ namespace citygml {
         void setSRSName(const std::string& srsName);
 
     protected:
-        ImplicitGeometry(const std::string& id);
+        ImplicitGeometry(const ObjectID& id);
 
         TransformationMatrix     m_matrix;
         TVec3d                   m_referencePoint;
@@ -15,7 +15,7 @@ namespace citygml {
     class LIBCITYGML_EXPORT LinearRing : public Object
     {
     public:
-        LinearRing( const std::string& id, bool isExterior );
+        LinearRing( const ObjectID& id, bool isExterior );
 
         bool isExterior() const;
 
@@ -29,6 +29,13 @@ namespace citygml {
 
         TVec3d computeNormal() const;
 
+        /**
+         * @brief checks if the ring is a simple, strictly convex polygon
+         * @param normal the normal of the ring as returned by computeNormal()
+         * @note collinear or duplicate consecutive vertices (except for the closing vertex) make the ring non convex
+         */
+        bool isConvex(const TVec3d& normal) const;
+
         void removeDuplicateVertices(const std::vector<TextureTargetDefinition*>& targets , std::shared_ptr<CityGMLLogger> logger);
 
         void forgetVertices();
@@ -31,7 +31,7 @@ namespace citygml {
         void setDimensions(int dim);
 
     protected:
-        LineString(const std::string& id);
+        LineString(const ObjectID& id);
         std::vector<TVec2d> m_vertices_2d;
         std::vector<TVec3d> m_vertices_3d;
         int m_dimensions;
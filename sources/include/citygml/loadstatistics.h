@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <citygml/citygml_api.h>
+#include <citygml/cityobject.h>
+
+namespace citygml {
+
+    /**
+     * @brief The LoadStatistics class contains the phase timings and the counts of a load call (see ParserParams::statistics)
+     */
+    class LIBCITYGML_EXPORT LoadStatistics {
+    public:
+        /**
+         * @brief the time spent in a phase of the load call in seconds
+         *
+         * The cpu time is the processor time of the whole process (all threads) while the phase was running.
+         */
+        struct PhaseTime {
+            PhaseTime() : wallTime(0.0), cpuTime(0.0) {}
+
+            double wallTime;
+            double cpuTime;
+        };
+
+        LoadStatistics();
+
+        void reset();
+
+        // The xml parsing including the creation of the objects. If the document is split into chunks that are parsed by several threads
+        // this is the time of the slowest chunk.
+        PhaseTime parsing;
+        // The resolution of the polygon and geometry xlinks and the assignment of the appearances (CityGMLFactory::closeFactory)
+        PhaseTime resolving;
+        // The tesselation and the other post processing of the CityObjects (CityModel::finish)
+        PhaseTime finishing;
+        // The transformation into ParserParams::destSRS (GeoCoordinateTransformer)
+        PhaseTime transformation;
+
+        // The size of the parsed document
+        uint64_t bytesRead;
+
+        // The number of xml elements (including unknown elements and elements that are skipped)
+        uint64_t elements;
+        uint64_t unknownElements;
+        // The number of elements that are passed to the element parsers by element name (e.g. "gml:polygon")
+        std::map<std::string, uint64_t> elementsByName;
+
+        // The CityObjects (including nested ones) of the model and the CityObjects passed to the callback of streamCityObjects
+        uint64_t cityObjects;
+        std::map<CityObject::CityObjectsType, uint64_t> cityObjectsByType;
+
+        // The polygons of the geometries of these CityObjects (shared polygons are counted for each geometry)
+        uint64_t polygons;
+        uint64_t vertices;
+        uint64_t triangles;
+
+        // The polygon and geometry xlinks
+        uint64_t resolvedXLinks;
+        uint64_t unresolvedXLinks;
+    };
+
+}
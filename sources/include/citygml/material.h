@@ -44,7 +44,7 @@ namespace citygml {
         virtual std::shared_ptr<const Material> asMaterial() const override;
 
     protected:
-        Material( const std::string& id );
+        Material( const ObjectID& id );
         TVec3f m_diffuse;
         TVec3f m_emissive;
         TVec3f m_specular;
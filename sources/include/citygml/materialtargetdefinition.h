@@ -14,7 +14,7 @@ namespace citygml {
     class LIBCITYGML_EXPORT MaterialTargetDefinition : public AppearanceTargetDefinition<Material> {
         friend class CityGMLFactory;
     protected:
-        MaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const std::string& id);
+        MaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const ObjectID& id);
 
     };
 }
@@ -1,21 +1,47 @@
 #pragma once
 
 #include <string>
+#include <atomic>
 
 #include <citygml/citygml_api.h>
 #include <citygml/attributesmap.h>
+#include <citygml/objectid.h>
 
 namespace citygml {
+
+    class ObjectArena;
+
     /**
      * @brief The base object associated with an unique id and a set of attributes (key-value pairs)
      */
     class LIBCITYGML_EXPORT Object
     {
     public:
-        Object( const std::string& id );
+        Object( const ObjectID& id );
+
+        /**
+         * @brief copies take over the id string of other (a lazy id is created first)
+         */
+        Object( const Object& other );
+        Object& operator=( const Object& other );
 
+        /**
+         * @brief the id of the object
+         * @note the string of a generated id (see ParserParams::compactIDs) is created by the first call
+         */
         const std::string& getId() const;
 
+        /**
+         * @brief returns wether the object has no gml:id but a generated id (see ParserParams::compactIDs)
+         * @note objects with generated ids can not be referenced by other elements of the document (e.g. by xlinks)
+         */
+        bool hasGeneratedId() const;
+
+        /**
+         * @brief the numeric form of the generated id or 0 if the object has no generated id
+         */
+        uint64_t getGeneratedId() const;
+
         std::string getAttribute( const std::string& name ) const;
 
         const AttributesMap& getAttributes() const;
@@ -24,11 +50,22 @@ namespace citygml {
 
         virtual ~Object() {}
 
+        /**
+         * @brief objects are allocated on the heap unless an arena is passed with new (arena) T(...) (see ObjectArena)
+         */
+        static void* operator new(size_t size);
+        static void* operator new(size_t size, ObjectArena* arena);
+        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, ObjectArena* arena);
+
         void setAttribute(const std::string& name, const std::string& value, AttributeType type = AttributeType::String, bool overwrite = true );
 
     protected:
 
-        std::string m_id;
+        // The string of generated ids and of objects created with an empty id is created on demand, m_lazyId is cleared afterwards
+        mutable std::string m_id;
+        uint64_t m_generatedId;
+        mutable std::atomic<bool> m_lazyId;
 
         AttributesMap m_attributes;
     };
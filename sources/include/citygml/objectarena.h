@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <citygml/citygml_api.h>
+
+namespace citygml {
+
+    /**
+     * @brief The ObjectArena class provides the memory of the objects created by a CityGMLFactory (see ParserParams::objectArena)
+     *
+     * The objects (CityObjects, geometries, polygons, rings, appearances, ...) and the control blocks of their shared pointers are placed
+     * one after another in large blocks. Deleting an object does not release its memory, instead all blocks are released at once when the
+     * last object of the arena is deleted. Hence the teardown of a model does not return every single object to the heap and the objects of
+     * different models do not interleave in the heap of long running processes.
+     *
+     * The arena is reference counted: its creator and every object placed in it hold a reference, i.e. objects that are still referenced after
+     * the CityModel was destroyed (e.g. shared polygons) remain valid.
+     * @note allocate is not thread safe (every factory fills its own arena), objects placed in the arena may be deleted by any thread.
+     *       The memory of the members of the objects (vertex lists, strings, attribute maps) is not taken from the arena.
+     */
+    class LIBCITYGML_EXPORT ObjectArena {
+    public:
+        static const size_t DefaultBlockSize = 1 << 20;
+
+        /**
+         * @brief creates an arena, the caller owns the first reference
+         */
+        static ObjectArena* create(size_t blockSize = DefaultBlockSize);
+
+        void addReference();
+
+        /**
+         * @brief releases a reference, the arena and all its blocks are freed when the last reference is released
+         */
+        void releaseReference();
+
+        /**
+         * @brief returns size bytes aligned for any type, the memory is valid until the arena is freed
+         * @note does not add a reference to the arena
+         */
+        void* allocate(size_t size);
+
+        /**
+         * @brief the number of bytes taken from the blocks so far
+         */
+        size_t getAllocatedBytes() const;
+
+        /**
+         * @brief allocates the memory of an Object (see Object::operator new)
+         *
+         * The memory is preceded by a header that records the arena, hence deallocateObject and getArena work for objects of
+         * both origins.
+         * @param arena the arena that provides the memory (a reference is added) or nullptr to allocate on the heap
+         */
+        static void* allocateObject(size_t size, ObjectArena* arena);
+        static void deallocateObject(void* object);
+
+        /**
+         * @brief returns the arena that provides the memory of object or nullptr if object was allocated on the heap
+         * @param object an Object created with new (see Object::operator new), not a subobject of it
+         */
+        static ObjectArena* getArena(const void* object);
+
+        /**
+         * @brief The Allocator class allocates from an arena and holds a reference to the arena for every allocation
+         *
+         * Used to place the control blocks of shared pointers in the arena.
+         */
+        template<class T> class Allocator {
+        public:
+            typedef T value_type;
+
+            explicit Allocator(ObjectArena* arena) : m_arena(arena) {}
+
+            template<class U> Allocator(const Allocator<U>& other) : m_arena(other.getArena()) {}
+
+            T* allocate(size_t n)
+            {
+                T* ptr = static_cast<T*>(m_arena->allocate(n * sizeof(T)));
+                m_arena->addReference();
+                return ptr;
+            }
+
+            void deallocate(T*, size_t)
+            {
+                m_arena->releaseReference();
+            }
+
+            ObjectArena* getArena() const
+            {
+                return m_arena;
+            }
+
+            template<class U> bool operator==(const Allocator<U>& other) const { return m_arena == other.getArena(); }
+            template<class U> bool operator!=(const Allocator<U>& other) const { return m_arena != other.getArena(); }
+
+        private:
+            ObjectArena* m_arena;
+        };
+
+        /**
+         * @brief takes the ownership of object, the control block of the shared pointer is placed in the arena of object (if it has one)
+         * @param object an Object created with new (see getArena)
+         */
+        template<class T> static std::shared_ptr<T> share(T* object)
+        {
+            ObjectArena* arena = getArena(object);
+            if (arena == nullptr) {
+                return std::shared_ptr<T>(object);
+            }
+            return std::shared_ptr<T>(object, std::default_delete<T>(), Allocator<T>(arena));
+        }
+
+    private:
+        explicit ObjectArena(size_t blockSize);
+        ObjectArena(const ObjectArena&);
+        ObjectArena& operator=(const ObjectArena&);
+        ~ObjectArena();
+
+        std::atomic<size_t> m_references;
+
+        size_t m_blockSize;
+        std::vector<char*> m_blocks;
+        char* m_current;
+        size_t m_remaining;
+        size_t m_allocatedBytes;
+    };
+
+}
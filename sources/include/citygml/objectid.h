@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <citygml/citygml_api.h>
+
+namespace citygml {
+
+    /**
+     * @brief The ObjectID class is the identifier an Object is created with
+     *
+     * The id is either a string (usually the gml:id of the element) or a compact generated id for an element without gml:id.
+     * A generated id consists of the index of the parsed document (chunk) and the ordinal of the object in the document. Its
+     * string form "genID_<document>_<ordinal>" is only created when Object::getId is called.
+     */
+    class LIBCITYGML_EXPORT ObjectID {
+    public:
+        ObjectID();
+        ObjectID(std::string id);
+        ObjectID(const char* id);
+
+        /**
+         * @brief creates a generated id
+         * @param document the index of the document (less than 2^24)
+         * @param ordinal the ordinal of the object in the document (greater than 0 and less than 2^40)
+         */
+        static ObjectID generate(uint32_t document, uint64_t ordinal);
+
+        bool isGenerated() const;
+
+        /**
+         * @brief the numeric form of a generated id or 0 if the id is not generated
+         */
+        uint64_t getGeneratedID() const;
+
+        /**
+         * @brief the id if it is not generated
+         */
+        const std::string& getString() const;
+
+        /**
+         * @brief the string form of the id
+         */
+        std::string toString() const;
+
+        /**
+         * @brief the string form of the generated id generatedID
+         */
+        static std::string generatedIDToString(uint64_t generatedID);
+
+    private:
+        std::string m_id;
+        uint64_t m_generatedID;
+    };
+
+}
@@ -4,14 +4,16 @@
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
+#include <atomic>
 
 #include <citygml/citygml_api.h>
 #include <citygml/appearancetarget.h>
 #include <citygml/vecs.hpp>
 #include <citygml/linearring.h>
 #include <citygml/geometry.h>
+#include <citygml/span.h>
 
-class Tesselator;
+class TesselatorBase;
 
 namespace citygml {
 
@@ -19,6 +21,7 @@ namespace citygml {
     class CityGMLFactory;
     class Texture;
     class Material;
+    class VertexPool;
 
     /**
      * @brief The Polygon class implements the functionality of gml::Polygon and gml::SurfacePatch (gml::Rectangle, gml::Triangle) objects
@@ -33,12 +36,59 @@ namespace citygml {
         };
 
         // Get the vertices
+        // note: the lists are empty and an error is logged if the polygon was moved to a VertexPool (see ParserParams::vertexPools),
+        //       use getVertexCount and getVertex instead
         const std::vector<TVec3d>& getVertices() const;
         std::vector<TVec3d>& getVertices();
 
         // Get the indices
+        // note: the list is empty and an error is logged if the polygon was moved to a VertexPool (see ParserParams::vertexPools),
+        //       use getIndexCount and getIndex instead
         const std::vector<unsigned int>& getIndices() const;
 
+        /**
+         * @brief returns the vertices, works for the own lists and for a VertexPool
+         * @note the span is empty and an error is logged if the pool is compact (see ParserParams::compactVertices). Callers must use getVertex
+         *       (or getLocalVertexSpan and getVertexOrigin) in that case.
+         */
+        Span<const TVec3d> getVertexSpan() const;
+
+        /**
+         * @brief returns the indices, works for the own lists and for a VertexPool
+         * @note the indices refer to the vertices of this polygon (see getVertexSpan). The span is empty and an error is logged if the polygon
+         *       uses 16 bit indices (compact pools). Callers must use getIndex (or getShortIndexSpan) in that case.
+         */
+        Span<const unsigned int> getIndexSpan() const;
+
+        /**
+         * @brief the vertices as offsets from getVertexOrigin if the polygon was moved to a compact VertexPool, otherwise an empty span
+         */
+        Span<const TVec3f> getLocalVertexSpan() const;
+
+        /**
+         * @brief the origin of the local vertices (see getLocalVertexSpan), (0, 0, 0) if the vertices are not stored in a compact pool
+         */
+        TVec3d getVertexOrigin() const;
+
+        /**
+         * @brief the indices if the polygon was moved to a compact VertexPool and has less than 65536 vertices, otherwise an empty span
+         */
+        Span<const uint16_t> getShortIndexSpan() const;
+
+        /**
+         * @brief the vertices and indices independent of the storage mode (own lists, VertexPool or compact VertexPool)
+         */
+        size_t getVertexCount() const;
+        TVec3d getVertex(size_t i) const;
+        size_t getIndexCount() const;
+        unsigned int getIndex(size_t i) const;
+
+        /**
+         * @brief returns the texture coordinates for the given theme and side without copying them
+         * @return the texture coordinates or an empty span if there are no texture coordinates for this theme and side
+         */
+        Span<const TVec2f> getTexCoordSpanForTheme(const std::string& theme, bool front) const;
+
         /**
          * @brief returns the material of this polygon for the given theme and side
          * @param theme a name of an appearance theme
@@ -82,7 +132,40 @@ namespace citygml {
 
         void addRing( LinearRing* );
 
-        void finish(Tesselator& tesselator , bool optimize, std::shared_ptr<CityGMLLogger> logger);
+        void finish(TesselatorBase& tesselator , bool optimize, std::shared_ptr<CityGMLLogger> logger);
+
+        /**
+         * @brief creates a finished polygon that holds the triangles of all polygons (see CityObject::mergePolygons)
+         *
+         * The vertices, texture coordinates and the rebased indices of the polygons are concatenated in the given order. The merged polygon
+         * has a generated id (see Object::getId), the appearances and the normal orientation of the first polygon and no rings. The source
+         * polygons are not modified.
+         * @param polygons finished polygons with the same appearances (see AppearanceTarget::hasSameAppearancesAs)
+         */
+        static std::shared_ptr<Polygon> merge(const std::vector<std::shared_ptr<const Polygon> >& polygons, std::shared_ptr<CityGMLLogger> logger);
+
+        /**
+         * @brief appends the vertices, indices and texture coordinates to the lists of pool and releases the own lists
+         *
+         * Called by CityModel::createVertexPool after the polygon is finished. Does nothing if the polygon already uses a pool (shared polygons).
+         * @param originIndex the origin of the local vertices if the pool is compact (see VertexPool::addOrigin)
+         */
+        void moveToVertexPool(const std::shared_ptr<VertexPool>& pool, size_t originIndex = 0);
+
+        /**
+         * @brief the pool that holds the vertices of the polygon or nullptr if the polygon owns its lists
+         */
+        std::shared_ptr<const VertexPool> getVertexPool() const;
+
+        /**
+         * @brief the position of the first vertex of the polygon in VertexPool::getPositions (or VertexPool::getLocalPositions)
+         */
+        size_t getVertexPoolOffset() const;
+
+        /**
+         * @brief the position of the first index of the polygon in VertexPool::getIndices (or VertexPool::getShortIndices)
+         */
+        size_t getIndexPoolOffset() const;
 
         std::shared_ptr<LinearRing> exteriorRing(){
             return m_exteriorRing;
@@ -103,18 +186,19 @@ namespace citygml {
         virtual ~Polygon();
 
     protected:
-        Polygon( const std::string& id, std::shared_ptr<CityGMLLogger> logger );
+        Polygon( const ObjectID& id, std::shared_ptr<CityGMLLogger> logger );
 
         std::shared_ptr<const Texture> getTextureForTheme(const std::string& theme, bool front) const;
 
         /**
          * @brief fill the vertex array and creates a corresponding index array
          * @param tesselate if true the tesselator will be used to tesselate the linear rings
-         * @param tesselator the Tesselator object
+         * @param tesselator the tesselator object
          */
-        void computeIndices(Tesselator& tesselator, std::shared_ptr<CityGMLLogger> logger);
+        void computeIndices(TesselatorBase& tesselator, std::shared_ptr<CityGMLLogger> logger);
         void createSimpleIndices(std::shared_ptr<CityGMLLogger> logger);
-        void createIndicesWithTesselation(Tesselator& tesselator, std::shared_ptr<CityGMLLogger> logger);
+        void createIndicesWithTesselation(TesselatorBase& tesselator, const TVec3d& normal, std::shared_ptr<CityGMLLogger> logger);
+        void createIndicesForConvexRing(TesselatorBase& tesselator, std::shared_ptr<CityGMLLogger> logger);
         void removeDuplicateVerticesInRings(std::shared_ptr<CityGMLLogger> logger);
         std::vector<TVec2f> getTexCoordsForRingAndTheme(const LinearRing& ring, const std::string& theme, bool front);
         std::vector<std::vector<TVec2f> > getTexCoordListsForRing(const LinearRing& ring, const std::vector<std::string>& themesFront, const std::vector<std::string>& themesBack);
@@ -126,11 +210,27 @@ namespace citygml {
         std::unordered_map<std::string, std::vector<TVec2f> > m_themeToBackTexCoordsMap;
         std::vector<unsigned int> m_indices;
 
+        // The ranges of the vertices, indices and texture coordinates in m_vertexPool (if the polygon was moved to a pool)
+        struct PoolTexCoords {
+            size_t themeIndex;
+            bool front;
+            size_t offset;
+            size_t count;
+        };
+        std::shared_ptr<VertexPool> m_vertexPool;
+        size_t m_poolVertexOffset;
+        size_t m_poolVertexCount;
+        size_t m_poolIndexOffset;
+        size_t m_poolIndexCount;
+        size_t m_poolOriginIndex;
+        bool m_poolShortIndices;
+        std::vector<PoolTexCoords> m_poolTexCoords;
+
         std::shared_ptr<LinearRing> m_exteriorRing;
         std::vector<std::shared_ptr<LinearRing> > m_interiorRings;
 
         bool m_negNormal;
-        bool m_finished;
+        std::atomic<bool> m_finished;
 
         std::shared_ptr<CityGMLLogger> m_logger;
     };
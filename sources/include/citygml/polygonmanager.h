@@ -3,8 +3,11 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <citygml/documentposition.h>
+
 namespace citygml {
 
     class Polygon;
@@ -21,22 +24,57 @@ namespace citygml {
          * @brief the polygon with id polygonID will be added to geom when finished is called
          * @param geom the geometry object to which the polygon will be added
          * @param polygonID the id of the polygon
+         * @param position the location of the xlink, reported if the polygon does not exist
+         */
+        void requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonID, const DocumentPosition& position);
+
+        /**
+         * @brief resolves the requests made since the last call of finishRecentRequests if they only reference polygons of the given list
+         *        and none of the polygons is requested by a deferred request. The polygons are released afterwards.
+         * @param polygons the polygons of the object whose parsing has finished (e.g. a top level CityObject)
+         * @return false if the requests could not be resolved. The requests are deferred until finish is called in that case.
          */
-        void requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonID);
+        bool finishRecentRequests(const std::vector<Polygon*>& polygons);
+
+        /**
+         * @brief takes over the polygons and requests of other (which is empty afterwards)
+         *
+         * Used to combine the managers of document chunks that are parsed independently. Polygons of other replace polygons
+         * with the same id, as if other's document chunk was parsed behind this one.
+         */
+        void merge(PolygonManager& other);
 
         void finish();
 
+        /**
+         * @brief the number of requests that were resolved (by finishRecentRequests or finish)
+         */
+        size_t getResolvedRequestsCount() const;
+
+        /**
+         * @brief the number of requests for which finish found no polygon
+         */
+        size_t getUnresolvedRequestsCount() const;
+
         ~PolygonManager();
     private:
         struct PolygonRequest {
-            PolygonRequest(Geometry* target, std::string polygonID) : target(target), polygonID(polygonID) {}
+            PolygonRequest(Geometry* target, std::string polygonID, const DocumentPosition& position) : target(target), polygonID(polygonID), position(position) {}
             Geometry* target;
             std::string polygonID;
+            DocumentPosition position;
         };
 
         std::shared_ptr<CityGMLLogger> m_logger;
         std::vector<PolygonRequest> m_polygonRequests;
         std::unordered_map<std::string, std::shared_ptr<Polygon> > m_sharedPolygons;
+
+        // the requests in front of m_firstRecentRequest are deferred, m_deferredPolygonIDs contains the ids they request
+        size_t m_firstRecentRequest;
+
+        size_t m_resolvedRequests;
+        size_t m_unresolvedRequests;
+        std::unordered_set<std::string> m_deferredPolygonIDs;
     };
 
 }
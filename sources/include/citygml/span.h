@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace citygml {
+
+    /**
+     * @brief The Span class is a view of a contiguous sequence of elements (e.g. the vertices of a Polygon, see Polygon::getVertexSpan)
+     *
+     * The span does not own the elements, it becomes invalid when the container of the elements is changed or destroyed.
+     */
+    template<class T> class Span {
+    public:
+        typedef T value_type;
+        typedef T* iterator;
+
+        Span() : m_data(nullptr), m_size(0) {}
+        Span(T* data, size_t size) : m_data(data), m_size(size) {}
+
+        T* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        T* begin() const { return m_data; }
+        T* end() const { return m_data + m_size; }
+
+        T& operator[](size_t i) const { return m_data[i]; }
+        T& front() const { return m_data[0]; }
+        T& back() const { return m_data[m_size - 1]; }
+
+        /**
+         * @brief returns a copy of the elements
+         */
+        std::vector<typename std::remove_const<T>::type> toVector() const
+        {
+            return std::vector<typename std::remove_const<T>::type>(begin(), end());
+        }
+
+    private:
+        T* m_data;
+        size_t m_size;
+    };
+
+}
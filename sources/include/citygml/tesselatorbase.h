@@ -0,0 +1,99 @@
+/* -*-c++-*- libcitygml - Copyright (c) 2010 Joachim Pouderoux, BRGM
+*
+* This file is part of libcitygml library
+* http://code.google.com/p/libcitygml
+*
+* libcitygml is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 2.1 of the License, or
+* (at your option) any later version.
+*
+* libcitygml is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*/
+
+#pragma once
+
+#include <citygml/vecs.hpp>
+#include <vector>
+#include <memory>
+
+namespace citygml {
+    class CityGMLLogger;
+}
+
+/**
+ * @brief Base class of the polygon tesselators
+ *
+ * Collects the contours (vertices and texture coordinates) of a polygon and holds the tesselation result. The result
+ * contains all vertices of the contours in the order they were added followed by any vertices the tesselator creates.
+ */
+class TesselatorBase
+{
+public:
+    TesselatorBase( std::shared_ptr<citygml::CityGMLLogger> logger );
+    virtual ~TesselatorBase();
+
+    /**
+     * @brief starts the tesselation of a new polygon
+     * @param normal the normal of the polygon. The resulting triangles are oriented counter clockwise with respect to the normal.
+     */
+    virtual void init( const TVec3d& normal );
+
+    /**
+     * @brief Add a new contour - add the exterior ring first, then interiors
+     * @param textureCoordinatesLists a list of texture coordinates lists for the countour. Each list contains one texture coordinate for each vertex.
+     */
+    virtual void addContour(const std::vector<TVec3d>&, std::vector<std::vector<TVec2f> > textureCoordinatesLists);
+
+    // Let's tesselate!
+    virtual void compute() = 0;
+
+    /**
+     * @brief creates a new tesselator of the same type with the same settings (keepVertices, convexFastPath)
+     *
+     * Tesselators are not thread safe, hence every thread that tesselates polygons needs its own instance.
+     */
+    virtual std::unique_ptr<TesselatorBase> clone() const = 0;
+
+    // Tesselation result access
+    const std::vector<TVec3d>& getVertices() const;
+    const std::vector<std::vector<TVec2f> >& getTexCoords() const { return _texCoordsLists; }
+    const std::vector<unsigned int>& getIndices() const;
+
+    /**
+     * @brief takes the tesselation result out of the tesselator (the result is no longer accessible by the get methods afterwards)
+     * @note the result is copied into a vector of the exact size and the buffer of the tesselator is cleared. Hence the tesselator
+     *       keeps the capacity of its buffers for the next polygon (see init) and the polygon does not keep any spare capacity.
+     */
+    std::vector<TVec3d> takeVertices();
+    std::vector<std::vector<TVec2f> > takeTexCoords();
+    std::vector<unsigned int> takeIndices();
+
+    void setKeepVertices(bool val);
+    bool keepVertices() const;
+
+    /**
+     * @brief if enabled (default) polygons without interior rings whose exterior ring is convex are triangulated as
+     *        triangle fan instead of being passed to the tesselator
+     */
+    void setConvexFastPath(bool val);
+    bool convexFastPath() const;
+
+protected:
+    TVec3d _normal;
+
+    std::vector<TVec3d> _vertices;
+    std::vector<std::vector<TVec2f> > _texCoordsLists;
+    std::vector<unsigned int> _outIndices;
+
+    // the index of the first vertex of every contour in _vertices
+    std::vector<unsigned int> _contourBegins;
+
+    std::shared_ptr<citygml::CityGMLLogger> _logger;
+
+    bool _keepVertices;
+    bool _convexFastPath;
+};
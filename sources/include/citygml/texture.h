@@ -50,8 +50,8 @@ namespace citygml {
         virtual ~Texture();
 
     protected:
-        Texture( const std::string& id );
-        Texture( const std::string& id, const std::string& type );
+        Texture( const ObjectID& id );
+        Texture( const ObjectID& id, const std::string& type );
         std::string m_url;
         bool m_repeat;
         WrapMode m_wrapMode;
@@ -17,7 +17,7 @@ namespace citygml {
      */
     class TextureCoordinates : public Object {
     public:
-        TextureCoordinates(std::string id, std::string targetID);
+        TextureCoordinates(const ObjectID& id, std::string targetID);
 
         bool targets(const LinearRing& ring) const;
         std::string getTargetLinearRingID() const;
@@ -45,7 +45,7 @@ namespace citygml {
         ~TextureTargetDefinition();
 
     protected:
-        TextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const std::string& id);
+        TextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const ObjectID& id);
         std::vector<std::shared_ptr<TextureCoordinates> > m_coordinatesList;
         std::unordered_map<std::string, std::shared_ptr<TextureCoordinates> > m_idTexCoordMap;
     };
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <citygml/citygml_api.h>
+
+namespace citygml {
+
+    /**
+     * @brief The TraceSink class receives the begin and end events of the phases of the loader
+     *
+     * The events are only emitted if libcitygml is built with the CMake option LIBCITYGML_TRACING. Events of the same thread are
+     * properly nested, the methods are called from different threads if the document or the model is processed by several threads.
+     */
+    class LIBCITYGML_EXPORT TraceSink {
+    public:
+        /**
+         * @param name the name of the phase (a string literal)
+         * @param detail additional information (e.g. the id of the processed CityObject), might be empty
+         */
+        virtual void beginEvent(const char* name, const std::string& detail) = 0;
+        virtual void endEvent(const char* name) = 0;
+
+        virtual ~TraceSink();
+    };
+
+    /**
+     * @brief The ChromeTraceSink class writes the events in the Chrome trace event format (JSON)
+     *
+     * The trace can be viewed with chrome://tracing or https://ui.perfetto.dev. The JSON document is completed when the sink is destroyed.
+     */
+    class LIBCITYGML_EXPORT ChromeTraceSink : public TraceSink {
+    public:
+        /**
+         * @param stream the stream the trace is written to, it must outlive the sink
+         */
+        explicit ChromeTraceSink(std::ostream& stream);
+
+        /**
+         * @param fileName the file the trace is written to
+         */
+        explicit ChromeTraceSink(const std::string& fileName);
+
+        virtual void beginEvent(const char* name, const std::string& detail) override;
+        virtual void endEvent(const char* name) override;
+
+        virtual ~ChromeTraceSink();
+
+    private:
+        void writeEvent(const char* name, char phase, const std::string& detail);
+
+        std::ofstream m_file;
+        std::ostream& m_stream;
+        std::chrono::steady_clock::time_point m_start;
+
+        std::mutex m_mutex;
+        bool m_firstEvent;
+        // the thread ids of the trace are small numbers in the order the threads emit their first event
+        std::unordered_map<std::thread::id, unsigned int> m_threadIDs;
+    };
+
+    /**
+     * @brief sets the sink that receives the trace events of all loader threads, nullptr disables tracing (default)
+     * @note the sink must not be changed while a document is loaded
+     */
+    LIBCITYGML_EXPORT void setTraceSink(std::shared_ptr<TraceSink> sink);
+
+    LIBCITYGML_EXPORT std::shared_ptr<TraceSink> getTraceSink();
+
+    /**
+     * @brief passes the begin event to the trace sink if there is one
+     */
+    LIBCITYGML_EXPORT void traceBegin(const char* name, const std::string& detail = std::string());
+
+    /**
+     * @brief passes the end event to the trace sink if there is one
+     */
+    LIBCITYGML_EXPORT void traceEnd(const char* name);
+
+    /**
+     * @brief The ScopedTraceEvent class emits a begin event when it is created and the matching end event when it is destroyed
+     */
+    class LIBCITYGML_EXPORT ScopedTraceEvent {
+    public:
+        explicit ScopedTraceEvent(const char* name);
+        ScopedTraceEvent(const char* name, const std::string& detail);
+        ~ScopedTraceEvent();
+
+    private:
+        ScopedTraceEvent(const ScopedTraceEvent&);
+        ScopedTraceEvent& operator=(const ScopedTraceEvent&);
+
+        const char* m_name;
+    };
+
+    /**
+      * @brief trace macros used by the loader, they are removed unless libcitygml is built with LIBCITYGML_TRACING
+      */
+    #ifdef LIBCITYGML_TRACING
+        #define CITYGML_TRACE_CONCAT_(a, b) a ## b
+        #define CITYGML_TRACE_CONCAT(a, b) CITYGML_TRACE_CONCAT_(a, b)
+        #define CITYGML_TRACE_SCOPE(name) citygml::ScopedTraceEvent CITYGML_TRACE_CONCAT(citygmlTraceScope, __LINE__)(name)
+        #define CITYGML_TRACE_SCOPE_DETAIL(name, detail) citygml::ScopedTraceEvent CITYGML_TRACE_CONCAT(citygmlTraceScope, __LINE__)(name, detail)
+        #define CITYGML_TRACE_BEGIN(name) citygml::traceBegin(name)
+        #define CITYGML_TRACE_END(name) citygml::traceEnd(name)
+    #else
+        #define CITYGML_TRACE_SCOPE(name)
+        #define CITYGML_TRACE_SCOPE_DETAIL(name, detail)
+        #define CITYGML_TRACE_BEGIN(name)
+        #define CITYGML_TRACE_END(name)
+    #endif
+
+}
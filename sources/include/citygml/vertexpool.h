@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <citygml/citygml_api.h>
+#include <citygml/vecs.hpp>
+
+namespace citygml {
+
+    /**
+     * @brief The VertexPool class holds the vertices, indices and texture coordinates of all polygons of a CityModel (see ParserParams::vertexPools)
+     *
+     * Every polygon occupies a contiguous range of each list. The indices of a polygon refer to its own vertices, i.e. the index 0 is the
+     * first vertex of the polygon (see Polygon::getVertexPoolOffset). The texture coordinates are stored per theme and side, a polygon only
+     * occupies a range of the lists of the themes it has texture coordinates for.
+     * Whole model operations (export, transformation, bounding box computation) can run over the lists without visiting the polygons.
+     *
+     * A compact pool (see ParserParams::compactVertices) stores the vertices as single precision offsets from double precision origins
+     * (one per root CityObject) in getLocalPositions and the indices of polygons with less than 65536 vertices as 16 bit values in
+     * getShortIndices. getPositions is empty in that case and getIndices only holds the indices of the larger polygons.
+     */
+    class LIBCITYGML_EXPORT VertexPool {
+    public:
+        explicit VertexPool(bool compact = false);
+
+        bool isCompact() const;
+
+        std::vector<TVec3d>& getPositions();
+        const std::vector<TVec3d>& getPositions() const;
+
+        std::vector<unsigned int>& getIndices();
+        const std::vector<unsigned int>& getIndices() const;
+
+        std::vector<TVec3f>& getLocalPositions();
+        const std::vector<TVec3f>& getLocalPositions() const;
+
+        std::vector<uint16_t>& getShortIndices();
+        const std::vector<uint16_t>& getShortIndices() const;
+
+        size_t getOriginsCount() const;
+        const TVec3d& getOrigin(size_t originIndex) const;
+        size_t addOrigin(const TVec3d& origin);
+
+        size_t getThemesCount() const;
+        const std::string& getTheme(size_t themeIndex) const;
+
+        /**
+         * @brief looks up the index of a theme
+         * @return false if the pool has no texture coordinates for the theme
+         */
+        bool findTheme(const std::string& theme, size_t& themeIndex) const;
+
+        /**
+         * @brief returns the index of the theme, the theme is added if the pool does not contain it yet
+         */
+        size_t addTheme(const std::string& theme);
+
+        std::vector<TVec2f>& getTexCoords(size_t themeIndex, bool front);
+        const std::vector<TVec2f>& getTexCoords(size_t themeIndex, bool front) const;
+
+    private:
+        bool m_compact;
+
+        std::vector<TVec3d> m_positions;
+        std::vector<unsigned int> m_indices;
+
+        std::vector<TVec3f> m_localPositions;
+        std::vector<uint16_t> m_shortIndices;
+        std::vector<TVec3d> m_origins;
+
+        std::vector<std::string> m_themes;
+        std::vector<std::vector<TVec2f> > m_frontTexCoords;
+        std::vector<std::vector<TVec2f> > m_backTexCoords;
+    };
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <citygml/citygml_api.h>
+#include <citygml/vecs.hpp>
+
+namespace citygml {
+
+    class Polygon;
+    class Texture;
+    class Material;
+
+    /**
+     * @brief The WeldedMesh class is an indexed triangle mesh of polygons of a Geometry that share the same appearances (see ParserParams::weldVertices)
+     *
+     * Vertices of different polygons with the same position (within the weld tolerance) and the same texture coordinates are merged, hence
+     * adjacent faces (e.g. of a gml:Solid) share their vertices. Triangles that become degenerate by the welding are dropped.
+     */
+    class LIBCITYGML_EXPORT WeldedMesh {
+    public:
+        /**
+         * @brief the triangles of a source polygon in the index list of the mesh
+         */
+        struct PolygonRange {
+            std::shared_ptr<const Polygon> polygon;
+            size_t indexOffset;
+            size_t indexCount;
+        };
+
+        const std::vector<TVec3d>& getVertices() const;
+        const std::vector<unsigned int>& getIndices() const;
+
+        /**
+         * @brief returns the texture coordinates for the given theme and side or an empty list if there are none
+         */
+        const std::vector<TVec2f>& getTexCoordsForTheme(const std::string& theme, bool front) const;
+
+        /**
+         * @brief the appearances of the mesh (all polygons of the mesh have the same appearances), see Polygon::getTextureFor
+         */
+        std::shared_ptr<const Texture> getTextureFor(const std::string& theme, bool front) const;
+        std::shared_ptr<const Material> getMaterialFor(const std::string& theme, bool front) const;
+
+        const std::vector<PolygonRange>& getPolygonRanges() const;
+
+        /**
+         * @brief returns the polygon the triangle (index / 3) was created from
+         */
+        std::shared_ptr<const Polygon> getPolygonForTriangle(size_t triangle) const;
+
+        /**
+         * @brief welds the vertices of the polygons into one mesh per combination of appearances
+         * @param polygons the finished polygons
+         * @param themes the themes whose textures and materials distinguish the meshes (e.g. CityModel::themes)
+         * @param tolerance vertices whose coordinates differ by at most tolerance are merged
+         */
+        static std::vector<std::shared_ptr<const WeldedMesh> > create(const std::vector<std::shared_ptr<const Polygon> >& polygons, const std::vector<std::string>& themes, double tolerance);
+
+    private:
+        WeldedMesh();
+
+        std::vector<TVec3d> m_vertices;
+        std::vector<unsigned int> m_indices;
+        std::unordered_map<std::string, std::vector<TVec2f> > m_themeToFrontTexCoordsMap;
+        std::unordered_map<std::string, std::vector<TVec2f> > m_themeToBackTexCoordsMap;
+
+        std::vector<PolygonRange> m_polygonRanges;
+    };
+
+}
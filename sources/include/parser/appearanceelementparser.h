@@ -22,9 +22,9 @@ namespace citygml {
     protected:
         // CityGMLElementParser interface
         virtual bool parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
         // GMLObjectElementParser interface
         virtual Object* getObject() override;
@@ -8,6 +8,28 @@ namespace citygml {
     class CityGMLLogger;
     class DocumentLocation;
 
+    /**
+     * @brief attributes that are looked up for many elements
+     *
+     * Implementations of Attributes can look them up by precomputed names (@see Attributes::findAttribute)
+     */
+    enum class AttributeName {
+        GMLID,
+        XLinkHref,
+        SRSName,
+        SRSDimension,
+        Orientation,
+        Name,
+        Uri,
+        Ring,
+        Count
+    };
+
+    /**
+     * @brief the qualified name of the attribute (e.g. "gml:id")
+     */
+    const char* getAttributeQName(AttributeName name);
+
     /**
      * @brief The Attributes class provides methods to access the attributes of an xml element
      */
@@ -21,6 +43,22 @@ namespace citygml {
          * @return the value of the attribute or defvalue if no such attribute exists
          */
         virtual std::string getAttribute( const std::string& attname, const std::string& defvalue = "" ) const = 0;
+
+        /**
+         * @brief looks up one of the common attributes
+         * @param name the attribute
+         * @param value receives the value of the attribute. Pass the same string for many lookups to reuse its memory.
+         * @return false if no such attribute exists or its value is empty (value is empty in that case)
+         * @note the default implementation calls getAttribute with the qualified name of the attribute
+         */
+        virtual bool findAttribute( AttributeName name, std::string& value ) const;
+
+        /**
+         * @brief get the value of one of the common attributes
+         * @return the value of the attribute or defvalue if no such attribute exists
+         */
+        std::string getAttribute( AttributeName name, const std::string& defvalue = "" ) const;
+
         virtual const DocumentLocation& getDocumentLocation() const = 0;
 
         /**
@@ -29,8 +67,17 @@ namespace citygml {
          */
         std::string getCityGMLIDAttribute() const;
 
-        bool hasXLinkAttribute() const;
-        std::string getXLinkValue();
+        /**
+         * @brief the id "genID_<CityGMLFileName>_<LineNumber>_<ColumnNumber>" of an element without gml::id (see getCityGMLIDAttribute)
+         */
+        std::string getDefaultCityGMLID() const;
+
+        /**
+         * @brief looks up the xlink:href attribute and parses the reference in one step
+         * @param reference receives the referenced id (without leading '#') if the element has an xlink attribute
+         * @return false if the element has no xlink attribute
+         */
+        bool getXLinkReference(std::string& reference) const;
 
     protected:
         Attributes(std::shared_ptr<CityGMLLogger> logger);
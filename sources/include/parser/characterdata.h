@@ -0,0 +1,93 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <parser/numberparser.hpp>
+
+namespace citygml {
+
+    /**
+     * @brief The CharacterData class provides access to the text content of an xml element
+     *
+     * The text is either a std::string or a range of UTF-16 code units (the buffer of the xml parser). Numbers are parsed
+     * directly from the range, the conversion to a std::string is only done on demand.
+     */
+    class CharacterData {
+    public:
+        /**
+         * @brief empty text
+         */
+        CharacterData();
+
+        /**
+         * @brief text of a std::string, the string must outlive the CharacterData object
+         */
+        explicit CharacterData(const std::string& text);
+
+        /**
+         * @brief text of the UTF-16 range [begin, end), the range must outlive the CharacterData object
+         */
+        CharacterData(const char16_t* begin, const char16_t* end);
+
+        virtual ~CharacterData();
+
+        bool empty() const;
+
+        /**
+         * @brief the text as (UTF-8 encoded) std::string
+         */
+        const std::string& str() const;
+        operator const std::string&() const;
+
+        /**
+         * @brief scans the first value of the text
+         * @return false if the text does not start with a value of type T
+         */
+        template<class T> bool scanValue(T& value) const
+        {
+            if (m_begin != nullptr) {
+                const char16_t* it = m_begin;
+                return scanNumber(it, m_end, value);
+            }
+            const std::string& text = str();
+            const char* it = text.data();
+            return scanNumber(it, text.data() + text.size(), value);
+        }
+
+        /**
+         * @brief appends the whitespace separated values of the text to values
+         * @return false if the text contains a token that is not a value of type T
+         */
+        template<class T> bool parseNumberList(std::vector<T>& values) const
+        {
+            if (m_begin != nullptr) {
+                return citygml::parseNumberList(m_begin, m_end, values);
+            }
+            const std::string& text = str();
+            return citygml::parseNumberList(text.data(), text.data() + text.size(), values);
+        }
+
+    protected:
+        /**
+         * @brief converts the UTF-16 range [begin, end) to UTF-8
+         */
+        virtual std::string transcode(const char16_t* begin, const char16_t* end) const;
+
+    private:
+        CharacterData(const CharacterData&);
+        CharacterData& operator=(const CharacterData&);
+
+        const std::string* m_text;
+        const char16_t* m_begin;
+        const char16_t* m_end;
+
+        // the converted text of [m_begin, m_end)
+        mutable std::string m_transcoded;
+        mutable bool m_isTranscoded;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const CharacterData& characters);
+
+}
@@ -1,17 +1,24 @@
 #pragma once
 
 #include <citygml/citygml.h>
+#include <citygml/citygmllogger.h>
+#include <citygml/objectid.h>
+
+#include "parser/nodetypes.h"
+#include "parser/phasetimer.h"
 
-#include <stack>
 #include <memory>
+#include <vector>
 
 namespace citygml {
 
     class Attributes;
-    class CityGMLLogger;
+    class CharacterData;
     class DocumentLocation;
     class CityGMLFactory;
     class ElementParser;
+    class GeoCoordinateTransformer;
+    class Geometry;
 
     class CityGMLDocumentParser {
     public:
@@ -19,11 +26,71 @@ namespace citygml {
 
         std::shared_ptr<const CityModel> getModel();
 
+        /**
+         * @brief passes the top level CityObjects to callback as soon as they are parsed instead of adding them to the CityModel
+         * @see citygml::streamCityObjects
+         */
+        void setCityObjectCallback(CityObjectCallback callback);
+
+        /**
+         * @brief marks the parsed document as a chunk of a larger document (see splitDocumentAtCityObjectMembers)
+         *
+         * The post processing at the end of the document is skipped. The parsers of the following chunks must be merged into the
+         * parser of the first chunk with mergeDocumentChunk, which then must be finished with finishDocument.
+         * @param chunkIndex the index of the chunk, distinguishes the generated ids of the chunks (see ParserParams::compactIDs)
+         */
+        void setDocumentChunk(uint32_t chunkIndex);
+
+        /**
+         * @brief takes over the CityModel and the state of the factory (shared polygons, appearances, xlinks, ...) of the parser of
+         *        the following document chunk
+         */
+        void mergeDocumentChunk(CityGMLDocumentParser& chunk);
+
+        /**
+         * @brief post processes the parsed CityModel (resolves the xlinks, assigns the appearances, tesselates and transforms it)
+         * @note called by endDocument unless the document is a document chunk
+         */
+        void finishDocument();
+
         // Methods used by CityGMLElementParser
 
+        /**
+         * @brief adds a top level CityObject whose parsing has finished to the model or passes it to the CityObject callback
+         */
+        void addRootCityObject(CityModel& model, CityObject* obj);
+
+        /**
+         * @brief the gml:id of the element or a generated id if it has none (see ParserParams::compactIDs)
+         */
+        ObjectID getObjectID(const Attributes& attributes);
+
         void setCurrentElementParser(ElementParser* parser);
         void removeCurrentElementParser(const ElementParser* caller);
 
+        /**
+         * @brief the parameters the document is parsed with
+         */
+        const ParserParams& getParserParams() const;
+
+        /**
+         * @brief returns wether the character data of the element that was started last is evaluated
+         *
+         * This is not the case for elements that are skipped. The xml parser does not need to collect the text of such elements.
+         */
+        bool isCharacterDataRequired() const;
+
+        /**
+         * @brief returns wether messages of the log level are enabled
+         *
+         * The logger is asked once when the parser is created and at the start of the document. This keeps the check for disabled
+         * messages in the per element code to a single branch.
+         */
+        bool isLogEnabledFor(CityGMLLogger::LOGLEVEL level) const
+        {
+            return (m_enabledLogLevels & (1u << static_cast<unsigned int>(level))) != 0;
+        }
+
         /**
          * @brief the current location in the document
          */
@@ -40,6 +107,12 @@ namespace citygml {
          */
         void startElement( const std::string& name, Attributes& attributes);
 
+        /**
+         * @brief must be called for each xml element start tag instead of startElement(name, attributes) if the node of the element is known
+         * @param node the node of the xml element, must be valid (elements with unknown names must be reported by name)
+         */
+        void startElement( const NodeType::XMLNode& node, Attributes& attributes);
+
         /**
          * @brief must be called for each xml element end tag
          * @param name the name of the xml element
@@ -47,6 +120,12 @@ namespace citygml {
          */
         void endElement( const std::string& name, const std::string& characters );
 
+        /**
+         * @brief must be called for each xml element end tag instead of endElement(name, characters) if the node of the element is known
+         * @param node the node of the xml element, must be valid (elements with unknown names must be reported by name)
+         */
+        void endElement( const NodeType::XMLNode& node, const CharacterData& characters );
+
         /**
          * @brief must be called at the start of the document
          */
@@ -60,27 +139,59 @@ namespace citygml {
 
         std::shared_ptr<CityGMLLogger> m_logger;
     private:
-        void skipUnknownOrUnexpectedElement(const std::string& name);
-        bool checkCurrentElementUnownOrUnexpected_start(const std::string& name);
-        bool checkCurrentElementUnownOrUnexpected_end(const std::string& name);
+        void startKnownElement(const NodeType::XMLNode& node, Attributes& attributes);
+        void endKnownElement(const NodeType::XMLNode& node, const CharacterData& characters);
+        void releaseRemovedParsers();
+        void updateEnabledLogLevels();
+
+        void skipUnknownOrUnexpectedElement();
+        bool checkCurrentElementUnownOrUnexpected_start();
+        bool checkCurrentElementUnownOrUnexpected_end();
+
+        std::vector<std::unique_ptr<ElementParser> > m_parserStack;
 
-        std::stack<std::shared_ptr<ElementParser> > m_parserStack;
+        // bit i is set if messages of the log level i are enabled (see isLogEnabledFor)
+        unsigned int m_enabledLogLevels;
 
         /**
          * @brief The currently active parser (the one on which startElement or endElement was called last)
          *
-         * The active parser can remove itself from the stack at any time. Hence we need another shared_ptr reference
-         * to it so that it does not delete itself when removed from the stack.
+         * The active parser can remove itself from the stack at any time. Hence removed parsers are kept in m_removedParsers
+         * until the active parser returns so that it does not delete itself when removed from the stack.
          */
-        std::shared_ptr<ElementParser> m_activeParser;
+        ElementParser* m_activeParser;
+        std::vector<std::unique_ptr<ElementParser> > m_removedParsers;
+
+        std::unique_ptr<TesselatorBase> createTesselator() const;
+        void streamCityObject(std::unique_ptr<CityObject> obj, const CityModel& model);
+        void addCityObjectStatistics(const CityObject& obj);
+        void addGeometryStatistics(const Geometry& geom);
+        void publishStatistics();
 
         std::unique_ptr<CityGMLFactory> m_factory;
         std::shared_ptr<CityModel> m_rootModel;
         ParserParams m_parserParams;
 
+        // CityObject streaming
+        CityObjectCallback m_cityObjectCallback;
+        std::unique_ptr<TesselatorBase> m_streamTesselator;
+        std::unique_ptr<GeoCoordinateTransformer> m_streamTransformer;
+        std::vector<std::unique_ptr<CityObject> > m_deferredCityObjects;
+
+        bool m_documentChunk;
+
+        // generated ids
+        uint32_t m_documentIndex;
+        uint64_t m_generatedIDCount;
+
+        // statistics (only if ParserParams::statistics is set)
+        std::unique_ptr<LoadStatistics> m_statistics;
+        // the number of elements by type id of the node
+        std::vector<std::pair<const NodeType::XMLNode*, uint64_t> > m_elementCounts;
+        PhaseTimer m_parseTimer;
+
         bool m_currentElementUnknownOrUnexpected;
         int m_unknownElementOrUnexpectedElementDepth;
-        std::string m_unknownElementOrUnexpectedElementName;
     };
 
 }
@@ -46,7 +46,7 @@ namespace citygml {
          * @return true if the node was expected otherwise false
          * @note the CityGMLDocumentParser calls this method
          */
-        virtual bool endElement(const NodeType::XMLNode& node, const std::string& characters ) override;
+        virtual bool endElement(const NodeType::XMLNode& node, const CharacterData& characters ) override;
 
         virtual ~CityGMLElementParser();
 
@@ -64,7 +64,7 @@ namespace citygml {
          * @brief called for the end tag of the element to which the parser is bound
          * @return true if the node was expected otherwise false
          */
-        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters ) = 0;
+        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters ) = 0;
 
         /**
          * @brief called for the start tag of each child inside the element to which the parser is bound
@@ -77,7 +77,7 @@ namespace citygml {
          * @return true if the node was expected otherwise false
          * @note if a callback mechanism is used to share the result of this parser this method would be the right place to invoke the callback
          */
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters ) = 0;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters ) = 0;
 
         CityGMLFactory& m_factory;
     private:
@@ -20,9 +20,9 @@ namespace citygml {
 
         // CityGMLElementParser interface
         virtual bool parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
         // GMLFeatureCollectionElementParser interface
         virtual FeatureObject* getFeatureObject() override;
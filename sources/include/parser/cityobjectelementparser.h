@@ -3,9 +3,6 @@
 #include <parser/gmlfeaturecollectionparser.h>
 
 #include <functional>
-#include <unordered_map>
-#include <unordered_set>
-#include <mutex>
 
 #include <citygml/cityobject.h>
 
@@ -22,16 +19,23 @@ namespace citygml {
 
         // CityGMLElementParser interface
         virtual bool parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
         // GMLFeatureCollectionElementParser interface
         virtual FeatureObject* getFeatureObject() override;
 
     private:
-        static void initializeTypeIDTypeMap();
-        static void initializeAttributesSet();
+        /**
+         * @brief returns false if the node is not a CityObject
+         */
+        static bool getCityObjectsType(const NodeType::XMLNode& node, CityObject::CityObjectsType& type);
+
+        /**
+         * @brief returns false if the node is not a CityObject attribute element (e.g. bldg:measuredHeight)
+         */
+        static bool getAttributeTypeOfAttributeNode(const NodeType::XMLNode& node, AttributeType& type);
         static AttributeType getAttributeType(const NodeType::XMLNode& node);
 
         CityObject* m_model;
@@ -39,19 +43,10 @@ namespace citygml {
         std::string m_lastAttributeName;
         AttributeType m_lastAttributeType;
 
-        // The nodes that are valid CityObjects
-        static std::mutex initializedTypeIDMutex;
-        static std::unordered_map<int, CityObject::CityObjectsType> typeIDTypeMap;
-        static bool typeIDTypeMapInitialized;
-
-        static std::mutex initializedAttributeSetMutex;
-        static std::unordered_set<int> attributesSet;
-        static std::unordered_map<int, AttributeType> attributeTypeMap;
-        static bool attributesSetInitialized;
-
-        void parseGeometryForLODLevel(int lod);
-        void parseImplicitGeometryForLODLevel(int lod);
-        void parseGeometryPropertyElementForLODLevel(int lod, const std::string& id);
+        bool skipGeometryForLODLevel(int lod, const NodeType::XMLNode& node);
+        void parseGeometryForLODLevel(int lod, const NodeType::XMLNode& node);
+        void parseImplicitGeometryForLODLevel(int lod, const NodeType::XMLNode& node);
+        void parseGeometryPropertyElementForLODLevel(int lod, const NodeType::XMLNode& node, Attributes& attributes);
     };
 
 }
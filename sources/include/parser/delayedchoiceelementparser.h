@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 
 #include "parser/elementparser.h"
 
@@ -11,27 +12,44 @@ namespace citygml {
      * @brief The DelayedChoiceElementParser allows to parse xml elements of which the concrete type is not known in advance
      *
      * The DelayedChoiceElementParser is initialized with a list of possible parses. When the start element of the next node is parsed it chooses the
-     * first parser that can handle the element.
+     * first parser that can handle the element. Only the chosen parser is created.
      */
     class DelayedChoiceElementParser : public ElementParser {
     public:
 
+        /**
+         * @brief a possible parser
+         */
+        struct Choice {
+            /**
+             * @param parserName the name of the parser (for logging purposes)
+             * @param handlesElement returns wether the parser handles an element (@see ElementParser::handlesElement)
+             * @param createParser creates the parser if it is chosen
+             */
+            Choice(const char* parserName, bool (*handlesElement)(const NodeType::XMLNode&), std::function<ElementParser*()> createParser)
+                : parserName(parserName), handlesElement(handlesElement), createParser(std::move(createParser)) {}
+
+            const char* parserName;
+            bool (*handlesElement)(const NodeType::XMLNode&);
+            std::function<ElementParser*()> createParser;
+        };
+
         /**
          * @brief creates a DelayedChoiceElementParser
          * @param documentParser
          * @param logger
-         * @param choices the parsers to choose from. The DelayedChoiceElementParser takes ownership of the parsers.
+         * @param choices the parsers to choose from
          */
-        DelayedChoiceElementParser(CityGMLDocumentParser& documentParser, std::shared_ptr<CityGMLLogger> logger, std::vector<ElementParser*> choices);
+        DelayedChoiceElementParser(CityGMLDocumentParser& documentParser, std::shared_ptr<CityGMLLogger> logger, std::vector<Choice> choices);
 
         // ElementParser interface
         virtual bool startElement(const NodeType::XMLNode& node, Attributes& attributes);
-        virtual bool endElement(const NodeType::XMLNode& node, const std::string& characters);
+        virtual bool endElement(const NodeType::XMLNode& node, const CharacterData& characters);
         virtual bool handlesElement(const NodeType::XMLNode& node) const;
         virtual std::string elementParserName() const;
 
     private:
-        std::vector<ElementParser*> m_choices;
+        std::vector<Choice> m_choices;
     };
 
 }
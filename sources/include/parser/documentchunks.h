@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace citygml {
+
+    class CityGMLLogger;
+
+    /**
+     * @brief a byte range of the content of the root element (CityModel) of a document that starts with a cityObjectMember element
+     *
+     * The chunk is parsed as a document of its own that consists of the prolog of the original document (everything up to
+     * and including the start tag of the root element), the chunk and the end tag of the root element.
+     */
+    struct DocumentChunk {
+        size_t begin;
+        size_t end;
+
+        // Maps document locations of the chunk document to the original document. Lines of the chunk document starting with
+        // firstLine are shifted by lineOffset, columns of firstLine are shifted by columnOffset.
+        uint64_t firstLine;
+        int64_t lineOffset;
+        int64_t columnOffset;
+    };
+
+    /**
+     * @brief the result of splitDocumentAtCityObjectMembers
+     */
+    struct DocumentChunks {
+        // [0, prologEnd) contains everything up to and including the start tag of the root element
+        size_t prologEnd;
+
+        // [rootEndTagBegin, rootEndTagEnd) is the end tag of the root element
+        size_t rootEndTagBegin;
+        size_t rootEndTagEnd;
+
+        // the chunks in document order, together they cover [prologEnd, rootEndTagBegin)
+        std::vector<DocumentChunk> chunks;
+    };
+
+    /**
+     * @brief splits the content of the root element of a CityGML document in front of cityObjectMember elements into chunks of similar size
+     *
+     * The document is only scanned for markup (tags, comments, CDATA sections and processing instructions), hence the encoding
+     * of the document must be ASCII compatible (e.g. UTF-8 or ISO-8859-1).
+     * Splitting is refused if the document contains surfaceDataMember elements that reference surface data via xlink, as
+     * those are resolved while parsing and may reference surface data of another chunk.
+     * @param maxChunks the maximal number of chunks
+     * @param minChunkSize the minimal size of a chunk in bytes
+     * @return false if the document can not be split. result contains at least two chunks otherwise.
+     */
+    bool splitDocumentAtCityObjectMembers(const char* data, size_t size, size_t maxChunks, size_t minChunkSize, DocumentChunks& result,
+                                          std::shared_ptr<CityGMLLogger> logger);
+
+}
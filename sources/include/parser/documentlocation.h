@@ -4,6 +4,8 @@
 #include <ostream>
 #include <stdint.h>
 
+#include <citygml/documentposition.h>
+
 namespace citygml {
 
     class DocumentLocation {
@@ -13,6 +15,13 @@ namespace citygml {
         virtual uint64_t getCurrentColumn() const = 0;
     };
 
+    /**
+     * @brief the line and column of the location, e.g. to report unresolved references after parsing
+     */
+    inline DocumentPosition getDocumentPosition(const DocumentLocation& location) {
+        return DocumentPosition(location.getCurrentLine(), location.getCurrentColumn());
+    }
+
     inline std::ostream& operator<<( std::ostream& os, const DocumentLocation& o ) {
 
         if (o.getCurrentLine() == 0) {
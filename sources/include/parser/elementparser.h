@@ -1,13 +1,17 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <memory>
 
 #include "parser/nodetypes.h"
 
+#include <citygml/objectid.h>
+
 namespace citygml {
 
     class Attributes;
+    class CharacterData;
     class CityGMLDocumentParser;
     class CityGMLLogger;
     class CityGMLFactory;
@@ -35,7 +39,7 @@ namespace citygml {
          * @return true if the node was expected otherwise false
          * @note the CityGMLDocumentParser calls this method
          */
-        virtual bool endElement(const NodeType::XMLNode& node, const std::string& characters ) = 0;
+        virtual bool endElement(const NodeType::XMLNode& node, const CharacterData& characters ) = 0;
 
         /**
          * @brief returns wether the parser handels elements of type node
@@ -45,6 +49,13 @@ namespace citygml {
          */
         virtual bool handlesElement(const NodeType::XMLNode& node) const = 0;
 
+        /**
+         * @brief returns wether the parser evaluates the character data of the elements it is called for
+         * @note if false the character data passed to endElement is empty. This allows the xml parser to ignore the text
+         *       (e.g. of skipped elements) instead of collecting and converting it.
+         */
+        virtual bool requiresCharacterData() const;
+
         /**
          * @brief the name of the parser (for logging purposes)
          */
@@ -52,6 +63,15 @@ namespace citygml {
 
         virtual ~ElementParser();
 
+        /**
+         * @brief element parsers are allocated from per thread free lists of blocks of similar size
+         *
+         * A parser is created for almost every element of a document and deleted when the element ends. Recycling the memory
+         * of the deleted parsers avoids most of these heap allocations.
+         */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
     protected:
         /**
          * @brief sets a parser that will be called for the next element.
@@ -60,6 +80,11 @@ namespace citygml {
         void setParserForNextElement(ElementParser* parser);
         virtual const DocumentLocation& getDocumentLocation() const;
 
+        /**
+         * @brief the gml:id of the element or a generated id if it has none
+         */
+        ObjectID getObjectID(const Attributes& attributes);
+
         std::shared_ptr<CityGMLLogger> m_logger;
         CityGMLDocumentParser& m_documentParser;
     };
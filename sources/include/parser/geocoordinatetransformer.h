@@ -19,10 +19,21 @@ namespace citygml {
     class GeoCoordinateTransformer {
     public:
         GeoCoordinateTransformer(const std::string& destSRS, std::shared_ptr<CityGMLLogger> logger);
+        ~GeoCoordinateTransformer();
 
         void transformToDestinationSRS(CityModel* model);
+
+        /**
+         * @brief transforms a single top level CityObject
+         * @param modelSRS the srs of the CityModel (the default source srs of the object)
+         * @note Used to transform objects that are handed out before the document is completely parsed. Polygons are only
+         *       detected as shared (and transformed once) within the object.
+         */
+        void transformToDestinationSRS(CityObject& obj, const std::string& modelSRS);
     private:
         std::string m_destinationSRS;
+        std::unique_ptr<GeoTransform> m_modelTransformation;
+        std::string m_modelSRS;
         std::shared_ptr<CityGMLLogger> m_logger;
         std::unordered_map<Polygon*, std::string> m_transformedPolygonsSourceURNMap;
         std::unordered_map<LineString*, std::string> m_transformedLineStringsSourceURNMap;
@@ -17,12 +17,17 @@ namespace citygml {
         virtual std::string elementParserName() const override;
         virtual bool handlesElement(const NodeType::XMLNode &node) const override;
 
+        /**
+         * @brief returns wether node is a valid root element for this parser (@see ElementParser::handlesElement)
+         */
+        static bool isRootElement(const NodeType::XMLNode& node);
+
     protected:
         // CityGMLElementParser interface
         virtual bool parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
     private:
         std::function<void(std::shared_ptr<GeoreferencedTexture>)> m_callback;
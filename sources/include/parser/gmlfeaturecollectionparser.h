@@ -17,7 +17,7 @@ namespace citygml {
     protected:
         // CityGMLElementParser interface
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
         virtual FeatureObject* getFeatureObject() = 0;
 
@@ -16,7 +16,7 @@ namespace citygml {
     protected:
         // CityGMLElementParser interface
         virtual bool parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters) override;
+        virtual bool parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters) override;
 
         /**
          * @brief returns the object in which the parsed information will be stored
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace citygml {
+
+    /**
+     * @brief read only memory mapping of a whole file
+     */
+    class MemoryMappedFile {
+    public:
+        MemoryMappedFile();
+        ~MemoryMappedFile();
+
+        /**
+         * @brief maps the file (a previously mapped file is unmapped)
+         * @return false if the file could not be opened or mapped
+         */
+        bool open(const std::string& fileName);
+        void close();
+
+        /**
+         * @brief the content of the file or nullptr if the file is empty or not mapped
+         */
+        const char* data() const;
+        size_t size() const;
+
+    private:
+        MemoryMappedFile(const MemoryMappedFile&);
+        MemoryMappedFile& operator=(const MemoryMappedFile&);
+
+        const char* m_data;
+        size_t m_size;
+#ifdef WIN32
+        void* m_file;
+        void* m_mapping;
+#endif
+    };
+
+}
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <citygml/vecs.hpp>
+
+namespace citygml {
+
+    // Locale independent number scanning for the whitespace separated number lists of CityGML documents
+    // (gml:posList, gml:pos, app:textureCoordinates, ...).
+    //
+    // All functions work on a [begin, end) character range so that they can be used with std::string data as well as
+    // with the UTF-16 buffers of the xml parser. Only the characters of the xs:double lexical space are accepted
+    // (optional sign, digits, optional fraction and optional exponent), the decimal separator is always '.'.
+
+    template<typename CharT> inline bool isNumberListWhitespace(CharT c)
+    {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+    }
+
+    template<typename CharT> inline bool isNumberDigit(CharT c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /**
+     * @brief advances it to the first non whitespace character in [it, end)
+     * @return true if a non whitespace character was found
+     */
+    template<typename CharT> inline bool skipNumberListWhitespace(const CharT*& it, const CharT* end)
+    {
+        while (it != end && isNumberListWhitespace(*it)) {
+            ++it;
+        }
+        return it != end;
+    }
+
+    /**
+     * @brief counts the whitespace separated tokens in [begin, end)
+     *
+     * Used to reserve the output vectors of the number list parsers
+     */
+    template<typename CharT> inline size_t countNumberTokens(const CharT* begin, const CharT* end)
+    {
+        size_t count = 0;
+        bool inToken = false;
+        for (const CharT* it = begin; it != end; ++it) {
+            const bool whitespace = isNumberListWhitespace(*it);
+            if (!whitespace && !inToken) {
+                count++;
+            }
+            inToken = !whitespace;
+        }
+        return count;
+    }
+
+    /**
+     * @brief converts a number token that can not be converted exactly by scanNumber
+     *
+     * Used for tokens with more than 19 significant digits or large exponents. The stream is imbued with the classic
+     * locale so that the result does not depend on the global locale of the application.
+     */
+    template<typename CharT> inline double convertNumberTokenSlow(const CharT* begin, const CharT* end)
+    {
+        std::string token(static_cast<size_t>(end - begin), ' ');
+        for (size_t i = 0; begin + i != end; i++) {
+            token[i] = static_cast<char>(begin[i]);
+        }
+
+        std::istringstream ss(token);
+        ss.imbue(std::locale::classic());
+
+        double value = 0.0;
+        ss >> value;
+        return value;
+    }
+
+    /**
+     * @brief scans the next number in [it, end) skipping leading whitespace
+     * @param it the current position, set behind the number if it could be scanned
+     * @param value receives the number
+     * @return false if there is no number or the next token is not a valid number (it is left unchanged in that case)
+     */
+    template<typename CharT> inline bool scanNumber(const CharT*& it, const CharT* end, double& value)
+    {
+        // Exactly representable powers of ten. Multiplying (or dividing) an integer mantissa < 2^53 with one of them
+        // yields the correctly rounded result.
+        static const double exactPowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+        const CharT* cur = it;
+        if (!skipNumberListWhitespace(cur, end)) {
+            return false;
+        }
+
+        const CharT* tokenBegin = cur;
+
+        bool negative = false;
+        if (*cur == '-' || *cur == '+') {
+            negative = *cur == '-';
+            ++cur;
+        }
+
+        uint64_t mantissa = 0;
+        int significantDigits = 0;
+        int exponent = 0;
+        bool anyDigit = false;
+        bool truncated = false;
+
+        for (; cur != end && isNumberDigit(*cur); ++cur) {
+            anyDigit = true;
+            if (significantDigits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*cur - '0');
+                if (mantissa != 0) {
+                    significantDigits++;
+                }
+            } else {
+                exponent++;
+                truncated = truncated || *cur != '0';
+            }
+        }
+
+        if (cur != end && *cur == '.') {
+            ++cur;
+            for (; cur != end && isNumberDigit(*cur); ++cur) {
+                anyDigit = true;
+                if (significantDigits < 19) {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(*cur - '0');
+                    if (mantissa != 0) {
+                        significantDigits++;
+                    }
+                    exponent--;
+                } else {
+                    truncated = truncated || *cur != '0';
+                }
+            }
+        }
+
+        if (!anyDigit) {
+            return false;
+        }
+
+        if (cur != end && (*cur == 'e' || *cur == 'E')) {
+            ++cur;
+            bool negativeExponent = false;
+            if (cur != end && (*cur == '-' || *cur == '+')) {
+                negativeExponent = *cur == '-';
+                ++cur;
+            }
+
+            if (cur == end || !isNumberDigit(*cur)) {
+                return false;
+            }
+
+            int explicitExponent = 0;
+            for (; cur != end && isNumberDigit(*cur); ++cur) {
+                if (explicitExponent < 100000) {
+                    explicitExponent = explicitExponent * 10 + static_cast<int>(*cur - '0');
+                }
+            }
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        }
+
+        // A number must be followed by a separator
+        if (cur != end && !isNumberListWhitespace(*cur)) {
+            return false;
+        }
+
+        if (mantissa == 0) {
+            value = negative ? -0.0 : 0.0;
+        } else if (!truncated && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+            double result = static_cast<double>(mantissa);
+            result = exponent >= 0 ? result * exactPowersOfTen[exponent] : result / exactPowersOfTen[-exponent];
+            value = negative ? -result : result;
+        } else {
+            value = convertNumberTokenSlow(tokenBegin, cur);
+        }
+
+        it = cur;
+        return true;
+    }
+
+    template<typename CharT> inline bool scanNumber(const CharT*& it, const CharT* end, float& value)
+    {
+        double v;
+        if (!scanNumber(it, end, v)) {
+            return false;
+        }
+        value = static_cast<float>(v);
+        return true;
+    }
+
+    template<typename CharT, class T> inline bool scanNumber(const CharT*& it, const CharT* end, TVec2<T>& value)
+    {
+        const CharT* cur = it;
+        if (!scanNumber(cur, end, value.x) || !scanNumber(cur, end, value.y)) {
+            return false;
+        }
+        it = cur;
+        return true;
+    }
+
+    template<typename CharT, class T> inline bool scanNumber(const CharT*& it, const CharT* end, TVec3<T>& value)
+    {
+        const CharT* cur = it;
+        if (!scanNumber(cur, end, value.x) || !scanNumber(cur, end, value.y) || !scanNumber(cur, end, value.z)) {
+            return false;
+        }
+        it = cur;
+        return true;
+    }
+
+    template<typename CharT, class T> inline bool scanNumber(const CharT*& it, const CharT* end, TVec4<T>& value)
+    {
+        const CharT* cur = it;
+        if (!scanNumber(cur, end, value.x) || !scanNumber(cur, end, value.y) || !scanNumber(cur, end, value.z) || !scanNumber(cur, end, value.w)) {
+            return false;
+        }
+        it = cur;
+        return true;
+    }
+
+    /**
+     * @brief the number of scalar values that make up one value of type T
+     */
+    template<class T> struct NumberComponents { static const size_t value = 1; };
+    template<class T> struct NumberComponents<TVec2<T>> { static const size_t value = 2; };
+    template<class T> struct NumberComponents<TVec3<T>> { static const size_t value = 3; };
+    template<class T> struct NumberComponents<TVec4<T>> { static const size_t value = 4; };
+
+    /**
+     * @brief appends all values of the whitespace separated number list [begin, end) to values
+     * @return false if the list contains an invalid token or the number of scalars is not a multiple of the
+     *         components of T. All complete values in front of the error are appended anyway.
+     */
+    template<class T, typename CharT> inline bool parseNumberList(const CharT* begin, const CharT* end, std::vector<T>& values)
+    {
+        values.reserve(values.size() + countNumberTokens(begin, end) / NumberComponents<T>::value);
+
+        const CharT* it = begin;
+        T value;
+        while (skipNumberListWhitespace(it, end)) {
+            if (!scanNumber(it, end, value)) {
+                return false;
+            }
+            values.push_back(value);
+        }
+        return true;
+    }
+
+}
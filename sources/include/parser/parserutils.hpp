@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
+#include <parser/characterdata.h>
 #include <parser/documentlocation.h>
+#include <parser/numberparser.hpp>
 
 #include <citygml/transformmatrix.h>
 #include <citygml/citygmllogger.h>
@@ -13,34 +15,65 @@
 
 namespace citygml {
 
-    template<class T> inline T parseValue( const std::string &s, std::shared_ptr<citygml::CityGMLLogger>&, const DocumentLocation&)
+    template<class T> inline T parseValue( const std::string &s, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location)
     {
-        std::stringstream ss;
-        ss << s;
-        T v;
-        ss >> v;
+        const char* it = s.data();
+        T v = T();
+        if (!scanNumber(it, s.data() + s.size(), v)) {
+            CITYGML_LOG_WARN(logger, "Mismatch type, " << typeid(T).name() << " expected, got '" << s << "' at " << location);
+        }
         return v;
     }
 
-    inline TransformationMatrix parseMatrix( const std::string &s, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location)
+    template<class T> inline T parseValue( const CharacterData& characters, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location)
     {
-        std::stringstream ss;
-        ss << s;
-
+        T v = T();
+        if (!characters.scanValue(v)) {
+            CITYGML_LOG_WARN(logger, "Mismatch type, " << typeid(T).name() << " expected, got '" << characters << "' at " << location);
+        }
+        return v;
+    }
 
+    inline TransformationMatrix parseMatrix( const std::string &s, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location)
+    {
         double matrix[16] = { 1.0, 0.0, 0.0, 0.0,
                               0.0, 1.0, 0.0, 0.0,
                               0.0, 0.0, 1.0, 0.0,
                               0.0, 0.0, 0.0, 1.0 };
 
+        const char* it = s.data();
+        const char* end = s.data() + s.size();
         for (size_t i = 0; i < 16; ++i)
         {
-            if(ss.eof()) {
-                CITYGML_LOG_WARN(logger, "Matrix with 16 elements expected, got '" << i + 1 << "' at " << location << ". Matrix may be invalid.");
+            double value;
+            if (!scanNumber(it, end, value)) {
+                CITYGML_LOG_WARN(logger, "Matrix with 16 elements expected, got '" << i << "' at " << location << ". Matrix may be invalid.");
                 break;
             }
 
-            ss >> matrix[i];
+            matrix[i] = value;
+        }
+
+        return TransformationMatrix(matrix);
+    }
+
+    inline TransformationMatrix parseMatrix( const CharacterData& characters, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location)
+    {
+        double matrix[16] = { 1.0, 0.0, 0.0, 0.0,
+                              0.0, 1.0, 0.0, 0.0,
+                              0.0, 0.0, 1.0, 0.0,
+                              0.0, 0.0, 0.0, 1.0 };
+
+        std::vector<double> values;
+        values.reserve(16);
+        characters.parseNumberList(values);
+
+        if (values.size() < 16) {
+            CITYGML_LOG_WARN(logger, "Matrix with 16 elements expected, got '" << values.size() << "' at " << location << ". Matrix may be invalid.");
+        }
+
+        for (size_t i = 0; i < 16 && i < values.size(); ++i) {
+            matrix[i] = values[i];
         }
 
         return TransformationMatrix(matrix);
@@ -61,15 +94,24 @@ namespace citygml {
 
     template<class T> inline std::vector<T> parseVecList( const std::string &s,  std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location )
     {
-        std::stringstream ss;
-        ss << s;
-
-        T v;
         std::vector<T> vec;
-        while ( ss >> v )
-            vec.push_back( v );
+        if (!parseNumberList(s.data(), s.data() + s.size(), vec))
+        {
+            CITYGML_LOG_WARN(logger, "Mismatch type, list of " << typeid(T).name() << " expected at " << location << " Ring/Polygon may be incomplete!");
+        }
 
-        if ( !ss.eof() )
+        return vec;
+    }
+
+    template<> inline bool parseValue( const CharacterData& characters, std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location )
+    {
+        return parseValue<bool>(characters.str(), logger, location);
+    }
+
+    template<class T> inline std::vector<T> parseVecList( const CharacterData& characters,  std::shared_ptr<citygml::CityGMLLogger>& logger, const DocumentLocation& location )
+    {
+        std::vector<T> vec;
+        if (!characters.parseNumberList(vec))
         {
             CITYGML_LOG_WARN(logger, "Mismatch type, list of " << typeid(T).name() << " expected at " << location << " Ring/Polygon may be incomplete!");
         }
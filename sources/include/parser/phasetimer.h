@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <ctime>
+
+#include <citygml/loadstatistics.h>
+
+namespace citygml {
+
+    /**
+     * @brief The PhaseTimer class measures the wall time and the cpu time of a phase of the load call (see LoadStatistics)
+     */
+    class PhaseTimer {
+    public:
+        /**
+         * @param enabled if false the clocks are not read and addTo does nothing
+         */
+        explicit PhaseTimer(bool enabled = false)
+            : m_enabled(false)
+            , m_wallStart()
+            , m_cpuStart(0)
+        {
+            restart(enabled);
+        }
+
+        void restart(bool enabled)
+        {
+            m_enabled = enabled;
+            if (m_enabled) {
+                m_wallStart = std::chrono::steady_clock::now();
+                m_cpuStart = std::clock();
+            }
+        }
+
+        /**
+         * @brief adds the time since the (re)start of the timer to time
+         */
+        void addTo(LoadStatistics::PhaseTime& time) const
+        {
+            if (!m_enabled) {
+                return;
+            }
+            time.wallTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_wallStart).count();
+            time.cpuTime += static_cast<double>(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+        }
+
+    private:
+        bool m_enabled;
+        std::chrono::steady_clock::time_point m_wallStart;
+        std::clock_t m_cpuStart;
+    };
+
+}
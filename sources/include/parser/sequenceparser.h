@@ -28,7 +28,7 @@ namespace citygml {
 
         // ElementParser interface
         virtual bool startElement(const NodeType::XMLNode& node, Attributes& attributes);
-        virtual bool endElement(const NodeType::XMLNode& node, const std::string& characters);
+        virtual bool endElement(const NodeType::XMLNode& node, const CharacterData& characters);
         virtual bool handlesElement(const NodeType::XMLNode& node) const;
         virtual std::string elementParserName() const;
 
@@ -23,8 +23,9 @@ namespace citygml {
         // ElementParser interface
         virtual std::string elementParserName() const override;
         virtual bool handlesElement(const NodeType::XMLNode &node) const override;
+        virtual bool requiresCharacterData() const override;
         virtual bool startElement(const NodeType::XMLNode& node, Attributes& attributes) override;
-        virtual bool endElement(const NodeType::XMLNode& node, const std::string& characters)  override;
+        virtual bool endElement(const NodeType::XMLNode& node, const CharacterData& characters)  override;
 
     private:
         NodeType::XMLNode m_skipNode;
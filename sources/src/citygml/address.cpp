@@ -2,7 +2,7 @@
 
 namespace citygml {
 
-    Address::Address(const std::string& id)
+    Address::Address(const ObjectID& id)
     : Object(id)
     {
     }
@@ -0,0 +1,121 @@
+#include <citygml/aggregatinglogger.h>
+
+#include <sstream>
+
+namespace citygml {
+
+    AggregatingLogger::AggregatingLogger(std::shared_ptr<CityGMLLogger> logger, unsigned int maxExamples)
+        : CityGMLLogger(logger->getLogLevel())
+        , m_logger(logger)
+        , m_maxExamples(maxExamples)
+    {
+        for (std::atomic<uint64_t>& count : m_warningCounts) {
+            count.store(0);
+        }
+    }
+
+    void AggregatingLogger::log(LOGLEVEL level, const std::string& message, const char* file, int line) const
+    {
+        m_logger->log(level, message, file, line);
+    }
+
+    bool AggregatingLogger::isEnabledFor(LOGLEVEL level) const
+    {
+        return m_logger->isEnabledFor(level);
+    }
+
+    CityGMLLogger::LOGLEVEL AggregatingLogger::getLogLevel() const
+    {
+        return m_logger->getLogLevel();
+    }
+
+    CityGMLLogger::LOGLEVEL AggregatingLogger::setLogLevel(LOGLEVEL level)
+    {
+        return m_logger->setLogLevel(level);
+    }
+
+    bool AggregatingLogger::acceptWarning(WARNINGTYPE type) const
+    {
+        // Only the examples are formatted, all other warnings are just counted
+        const uint64_t count = m_warningCounts[static_cast<int>(type)].fetch_add(1, std::memory_order_relaxed);
+        return count < m_maxExamples;
+    }
+
+    void AggregatingLogger::logWarning(WARNINGTYPE type, const std::string& message, const char*, int) const
+    {
+        std::lock_guard<std::mutex> lock(m_examplesMutex);
+        std::vector<std::string>& examples = m_warningExamples[static_cast<int>(type)];
+        if (examples.size() < m_maxExamples) {
+            examples.push_back(message);
+        }
+    }
+
+    uint64_t AggregatingLogger::getWarningCount(WARNINGTYPE type) const
+    {
+        return m_warningCounts[static_cast<int>(type)].load(std::memory_order_relaxed);
+    }
+
+    std::vector<std::string> AggregatingLogger::getWarningExamples(WARNINGTYPE type) const
+    {
+        std::lock_guard<std::mutex> lock(m_examplesMutex);
+        return m_warningExamples[static_cast<int>(type)];
+    }
+
+    void AggregatingLogger::logSummary() const
+    {
+        if (!m_logger->isEnabledFor(LOGLEVEL::LL_WARNING)) {
+            return;
+        }
+
+        for (int i = 0; i < static_cast<int>(WARNINGTYPE::WT_COUNT); i++) {
+            const WARNINGTYPE type = static_cast<WARNINGTYPE>(i);
+            const uint64_t count = getWarningCount(type);
+            if (count == 0) {
+                continue;
+            }
+
+            std::stringstream ss;
+            ss << count << " warning(s) of type '" << getWarningTypeName(type) << "'.";
+            const std::vector<std::string> examples = getWarningExamples(type);
+            if (!examples.empty()) {
+                ss << (examples.size() < count ? " First " : " All ") << examples.size() << ":";
+                for (const std::string& example : examples) {
+                    ss << "\n    " << example;
+                }
+            }
+            m_logger->log(LOGLEVEL::LL_WARNING, ss.str());
+        }
+    }
+
+    const char* AggregatingLogger::getWarningTypeName(WARNINGTYPE type)
+    {
+        switch (type) {
+        case WARNINGTYPE::WT_UNKNOWN_ELEMENT:
+            return "unknown element";
+        case WARNINGTYPE::WT_UNEXPECTED_ELEMENT:
+            return "unexpected element";
+        case WARNINGTYPE::WT_RING_TOO_FEW_VERTICES:
+            return "LinearRing with less than 4 vertices";
+        case WARNINGTYPE::WT_POLYGON_TOO_FEW_VERTICES:
+            return "Polygon with less than 3 vertices";
+        case WARNINGTYPE::WT_TEXTURE_COORDINATES_MISMATCH:
+            return "number of texture coordinates does not match the number of vertices";
+        case WARNINGTYPE::WT_MISSING_APPEARANCE_TARGET:
+            return "appearance target does not exist";
+        case WARNINGTYPE::WT_UNRESOLVED_POLYGON_XLINK:
+            return "unresolved Polygon xlink";
+        case WARNINGTYPE::WT_UNRESOLVED_GEOMETRY_XLINK:
+            return "unresolved Geometry xlink";
+        case WARNINGTYPE::WT_DUPLICATE_ID:
+            return "duplicate id";
+        case WARNINGTYPE::WT_MISSING_SRS:
+            return "no valid spatial reference system";
+        case WARNINGTYPE::WT_TESSELATION_FAILED:
+            return "tesselation failed";
+        case WARNINGTYPE::WT_COUNT:
+            break;
+        }
+        return "unknown warning type";
+    }
+
+}
@@ -4,7 +4,7 @@
 
 namespace citygml {
 
-    Appearance::Appearance(const std::string& id, const std::string& typeString) : Object( id ), m_typeString( typeString ), m_isFront(true)
+    Appearance::Appearance(const ObjectID& id, const std::string& typeString) : Object( id ), m_typeString( typeString ), m_isFront(true)
     {
 
     }
@@ -26,7 +26,7 @@ namespace citygml {
 
     std::string Appearance::toString() const
     {
-        return m_typeString + " " + m_id;
+        return m_typeString + " " + getId();
     }
 
     std::shared_ptr<Material> Appearance::asMaterial()
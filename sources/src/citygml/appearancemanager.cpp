@@ -10,6 +10,8 @@ namespace citygml {
     AppearanceManager::AppearanceManager(std::shared_ptr<CityGMLLogger> logger)
     {
         m_logger = logger;
+        m_materialTargetDefinitionsCount = 0;
+        m_texTargetDefinitionsCount = 0;
     }
 
     AppearanceManager::~AppearanceManager()
@@ -36,62 +38,140 @@ namespace citygml {
 
     void AppearanceManager::addAppearanceTarget(AppearanceTarget* target)
     {
+        if (target->hasGeneratedId()) {
+            // Objects without gml:id can not be targeted by appearances
+            return;
+        }
         m_appearanceTargetsMap[target->getId()] = target;
     }
 
     void AppearanceManager::addAppearance(std::shared_ptr<Appearance> appearance)
     {
+        if (appearance->hasGeneratedId()) {
+            return;
+        }
         m_appearancesMap[appearance->getId()] = appearance;
     }
 
-    void AppearanceManager::addTextureTargetDefinition(std::shared_ptr<TextureTargetDefinition> targetDef)
+    void AppearanceManager::addTextureTargetDefinition(std::shared_ptr<TextureTargetDefinition> targetDef, const DocumentPosition& position)
     {
-        m_texTargetDefinitions.push_back(targetDef);
+        TargetDefinitions& targetDefinitions = getTargetDefinitions(targetDef->getTargetID(), position);
+        targetDefinitions.texTargetDefinitions.push_back(targetDef);
+        m_texTargetDefinitionsCount++;
     }
 
-    void AppearanceManager::addMaterialTargetDefinition(std::shared_ptr<MaterialTargetDefinition> targetDef)
+    void AppearanceManager::addMaterialTargetDefinition(std::shared_ptr<MaterialTargetDefinition> targetDef, const DocumentPosition& position)
     {
-        m_materialTargetDefinitions.push_back(targetDef);
+        TargetDefinitions& targetDefinitions = getTargetDefinitions(targetDef->getTargetID(), position);
+        targetDefinitions.materialTargetDefinitions.push_back(targetDef);
+        m_materialTargetDefinitionsCount++;
     }
 
-    template<class T> void assignTargetDefinition(std::shared_ptr<T>& targetDef, const std::unordered_map<std::string, AppearanceTarget*>& targetMap, std::shared_ptr<CityGMLLogger>& logger) {
-        std::string targetID = targetDef->getTargetID();
-        auto it = targetMap.find(targetID);
+    AppearanceManager::TargetDefinitions& AppearanceManager::getTargetDefinitions(const std::string& targetID, const DocumentPosition& position)
+    {
+        // The position of the first definition is kept
+        auto inserted = m_targetDefinitions.insert(std::make_pair(targetID, TargetDefinitions()));
+        if (inserted.second) {
+            inserted.first->second.position = position;
+        }
+        return inserted.first->second;
+    }
 
-        if (it == targetMap.end()) {
-            CITYGML_LOG_WARN(logger, "Appearance with id '" << targetDef->getAppearance()->getId() << "' targets object with id " << targetID << " but no such object exists.");
+    template<class T> void assignTargetDefinition(std::shared_ptr<T>& targetDef, AppearanceTarget* target, const DocumentPosition& position, std::shared_ptr<CityGMLLogger>& logger) {
+        if (target == nullptr) {
+            CITYGML_LOG_WARN_TYPE(logger, CityGMLLogger::WARNINGTYPE::WT_MISSING_APPEARANCE_TARGET, "Appearance with id '" << targetDef->getAppearance()->getId() << "' targets object with id " << targetDef->getTargetID() << " but no such object exists (target at" << position << ").");
         } else {
-            it->second->addTargetDefinition(targetDef);
+            target->addTargetDefinition(targetDef);
         }
     }
 
-    void AppearanceManager::assignAppearancesToTargets()
+    void AppearanceManager::assignTargetDefinitions(TargetDefinitions& targetDefinitions, AppearanceTarget* target)
     {
-        CITYGML_LOG_INFO(m_logger, "Start assignment of appearances to targets ("
-                         << m_materialTargetDefinitions.size() << " material target definition(s), "
-                         << m_texTargetDefinitions.size() << " texture target definition(s)).");
-
-        for (std::shared_ptr<MaterialTargetDefinition>& targetDef : m_materialTargetDefinitions ) {
-            assignTargetDefinition<MaterialTargetDefinition>(targetDef, m_appearanceTargetsMap, m_logger);
+        for (std::shared_ptr<MaterialTargetDefinition>& targetDef : targetDefinitions.materialTargetDefinitions ) {
+            assignTargetDefinition<MaterialTargetDefinition>(targetDef, target, targetDefinitions.position, m_logger);
             addThemesFrom(targetDef->getAppearance());
         }
 
-        for (std::shared_ptr<TextureTargetDefinition>& targetDef : m_texTargetDefinitions ) {
-            assignTargetDefinition<TextureTargetDefinition>(targetDef, m_appearanceTargetsMap, m_logger);
+        for (std::shared_ptr<TextureTargetDefinition>& targetDef : targetDefinitions.texTargetDefinitions ) {
+            assignTargetDefinition<TextureTargetDefinition>(targetDef, target, targetDefinitions.position, m_logger);
             addThemesFrom(targetDef->getAppearance());
         }
 
-        m_materialTargetDefinitions.clear();
-        m_texTargetDefinitions.clear();
+        m_materialTargetDefinitionsCount -= targetDefinitions.materialTargetDefinitions.size();
+        m_texTargetDefinitionsCount -= targetDefinitions.texTargetDefinitions.size();
+    }
+
+    void AppearanceManager::merge(AppearanceManager& other)
+    {
+        for (auto& entry : other.m_appearancesMap) {
+            m_appearancesMap[entry.first] = entry.second;
+        }
+
+        for (auto& entry : other.m_appearanceTargetsMap) {
+            m_appearanceTargetsMap[entry.first] = entry.second;
+        }
+
+        for (auto& entry : other.m_targetDefinitions) {
+            TargetDefinitions& targetDefinitions = getTargetDefinitions(entry.first, entry.second.position);
+            targetDefinitions.materialTargetDefinitions.insert(targetDefinitions.materialTargetDefinitions.end(),
+                                                               entry.second.materialTargetDefinitions.begin(), entry.second.materialTargetDefinitions.end());
+            targetDefinitions.texTargetDefinitions.insert(targetDefinitions.texTargetDefinitions.end(),
+                                                          entry.second.texTargetDefinitions.begin(), entry.second.texTargetDefinitions.end());
+        }
+
+        m_materialTargetDefinitionsCount += other.m_materialTargetDefinitionsCount;
+        m_texTargetDefinitionsCount += other.m_texTargetDefinitionsCount;
+        m_themes.insert(other.m_themes.begin(), other.m_themes.end());
+
+        other.m_appearancesMap.clear();
+        other.m_appearanceTargetsMap.clear();
+        other.m_targetDefinitions.clear();
+        other.m_materialTargetDefinitionsCount = 0;
+        other.m_texTargetDefinitionsCount = 0;
+        other.m_themes.clear();
+    }
+
+    void AppearanceManager::assignAppearancesToTargets()
+    {
+        CITYGML_LOG_INFO(m_logger, "Start assignment of appearances to targets ("
+                         << m_materialTargetDefinitionsCount << " material target definition(s), "
+                         << m_texTargetDefinitionsCount << " texture target definition(s)).");
+
+        for (auto& targetDefinitions : m_targetDefinitions) {
+            auto it = m_appearanceTargetsMap.find(targetDefinitions.first);
+            assignTargetDefinitions(targetDefinitions.second, it != m_appearanceTargetsMap.end() ? it->second : nullptr);
+        }
+
+        m_targetDefinitions.clear();
         m_appearanceTargetsMap.clear();
         m_appearancesMap.clear();
 
         CITYGML_LOG_INFO(m_logger, "Finished assignment of appearances to targets ("
-                         << m_materialTargetDefinitions.size() << " material target definition(s), "
-                         << m_texTargetDefinitions.size() << " texture target definition(s)).");
+                         << m_materialTargetDefinitionsCount << " material target definition(s), "
+                         << m_texTargetDefinitionsCount << " texture target definition(s)).");
 
     }
 
+    void AppearanceManager::assignAppearancesToTargets(const std::vector<AppearanceTarget*>& targets)
+    {
+        for (AppearanceTarget* target : targets) {
+            if (target->hasGeneratedId()) {
+                continue;
+            }
+
+            auto it = m_targetDefinitions.find(target->getId());
+            if (it != m_targetDefinitions.end()) {
+                assignTargetDefinitions(it->second, target);
+                m_targetDefinitions.erase(it);
+            }
+
+            auto targetIt = m_appearanceTargetsMap.find(target->getId());
+            if (targetIt != m_appearanceTargetsMap.end() && targetIt->second == target) {
+                m_appearanceTargetsMap.erase(targetIt);
+            }
+        }
+    }
+
     void AppearanceManager::addThemesFrom(std::shared_ptr<Appearance> surfaceData)
     {
         m_themes.insert(surfaceData->getThemes().begin(), surfaceData->getThemes().end());
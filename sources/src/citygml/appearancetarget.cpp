@@ -9,7 +9,25 @@
 
 namespace citygml {
 
-    AppearanceTarget::AppearanceTarget(const std::string& id) : Object(id)
+    namespace {
+        template<class TargetDefinition>
+        bool haveSameAppearances(const std::unordered_map<std::string, std::shared_ptr<TargetDefinition> >& map, const std::unordered_map<std::string, std::shared_ptr<TargetDefinition> >& other)
+        {
+            if (map.size() != other.size()) {
+                return false;
+            }
+
+            for (const auto& entry : map) {
+                const auto it = other.find(entry.first);
+                if (it == other.end() || it->second->getAppearance() != entry.second->getAppearance()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    AppearanceTarget::AppearanceTarget(const ObjectID& id) : Object(id)
     {
 
     }
@@ -118,6 +136,11 @@ namespace citygml {
         return themes;
     }
 
-
-
+    bool AppearanceTarget::hasSameAppearancesAs(const AppearanceTarget& other) const
+    {
+        return haveSameAppearances(m_themeTexMapFront, other.m_themeTexMapFront)
+                && haveSameAppearances(m_themeTexMapBack, other.m_themeTexMapBack)
+                && haveSameAppearances(m_themeMatMapFront, other.m_themeMatMapFront)
+                && haveSameAppearances(m_themeMatMapBack, other.m_themeMatMapBack);
+    }
 }
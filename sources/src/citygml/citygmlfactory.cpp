@@ -5,6 +5,7 @@
 #include <citygml/geometrymanager.h>
 #include <citygml/appearancetarget.h>
 #include <citygml/polygon.h>
+#include <citygml/linearring.h>
 #include <citygml/linestring.h>
 #include <citygml/implictgeometry.h>
 #include <citygml/texture.h>
@@ -13,27 +14,31 @@
 #include <citygml/materialtargetdefinition.h>
 #include <citygml/texturetargetdefinition.h>
 #include <citygml/citymodel.h>
+#include <citygml/envelope.h>
 #include <citygml/implictgeometry.h>
 #include <citygml/citygmllogger.h>
+#include <citygml/tracing.h>
+#include <citygml/objectarena.h>
 
 namespace citygml {
 
-    CityGMLFactory::CityGMLFactory(std::shared_ptr<CityGMLLogger> logger)
+    CityGMLFactory::CityGMLFactory(std::shared_ptr<CityGMLLogger> logger, bool useObjectArena)
     {
+        m_arena = useObjectArena ? ObjectArena::create() : nullptr;
         m_appearanceManager = std::unique_ptr<AppearanceManager>(new AppearanceManager(logger));
         m_polygonManager = std::unique_ptr<PolygonManager>(new PolygonManager(logger));
         m_geometryManager = std::unique_ptr<GeometryManager>(new GeometryManager(logger));
         m_logger = logger;
     }
 
-    CityModel* CityGMLFactory::createCityModel(const std::string& id)
+    CityModel* CityGMLFactory::createCityModel(const ObjectID& id)
     {
-        return new CityModel(id);
+        return new (m_arena) CityModel(id);
     }
 
-    CityObject* CityGMLFactory::createCityObject(const std::string& id, CityObject::CityObjectsType type)
+    CityObject* CityGMLFactory::createCityObject(const ObjectID& id, CityObject::CityObjectsType type)
     {
-        CityObject* cityObject = new CityObject(id, type);
+        CityObject* cityObject = new (m_arena) CityObject(id, type);
         return cityObject;
     }
 
@@ -64,87 +69,92 @@ namespace citygml {
 
     }
 
-    Geometry* CityGMLFactory::createGeometry(const std::string& id, const CityObject::CityObjectsType& cityObjType, unsigned int lod)
+    Geometry* CityGMLFactory::createGeometry(const ObjectID& id, const CityObject::CityObjectsType& cityObjType, unsigned int lod)
     {
-        Geometry* geom = new Geometry(id, mapCityObjectsTypeToGeometryType(cityObjType), lod);
+        Geometry* geom = new (m_arena) Geometry(id, mapCityObjectsTypeToGeometryType(cityObjType), lod);
         appearanceTargetCreated(geom);
         return geom;
     }
 
-    std::shared_ptr<Polygon> CityGMLFactory::createPolygon(const std::string& id)
+    std::shared_ptr<Polygon> CityGMLFactory::createPolygon(const ObjectID& id)
     {
-        Polygon* poly = new Polygon(id, m_logger);
+        Polygon* poly = new (m_arena) Polygon(id, m_logger);
         appearanceTargetCreated(poly);
 
-        std::shared_ptr<Polygon> shared = std::shared_ptr<Polygon>(poly);
+        std::shared_ptr<Polygon> shared = ObjectArena::share(poly);
         m_polygonManager->addPolygon(shared);
 
         return shared;
     }
 
-    std::shared_ptr<LineString> CityGMLFactory::createLineString(const std::string& id)
+    LinearRing* CityGMLFactory::createLinearRing(const ObjectID& id, bool isExterior)
     {
-        LineString* lineString = new LineString(id);
-        return std::shared_ptr<LineString>(lineString);
+        return new (m_arena) LinearRing(id, isExterior);
+    }
+
+    std::shared_ptr<LineString> CityGMLFactory::createLineString(const ObjectID& id)
+    {
+        LineString* lineString = new (m_arena) LineString(id);
+        return ObjectArena::share(lineString);
 
     }
 
-    void CityGMLFactory::requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonId)
+    void CityGMLFactory::requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonId, const DocumentPosition& position)
     {
-        m_polygonManager->requestSharedPolygonForGeometry(geom, polygonId);
+        m_polygonManager->requestSharedPolygonForGeometry(geom, polygonId, position);
     }
 
-    ImplicitGeometry *CityGMLFactory::createImplictGeometry(const std::string& id)
+    ImplicitGeometry *CityGMLFactory::createImplictGeometry(const ObjectID& id)
     {
-        return new ImplicitGeometry(id);
+        return new (m_arena) ImplicitGeometry(id);
     }
 
     std::shared_ptr<Geometry> CityGMLFactory::shareGeometry(Geometry* geom)
     {
-        std::shared_ptr<Geometry> shared = std::shared_ptr<Geometry>(geom);
+        std::shared_ptr<Geometry> shared = ObjectArena::share(geom);
 
         m_geometryManager->addSharedGeometry(shared);
 
         return shared;
     }
 
-    void CityGMLFactory::requestSharedGeometryWithID(ImplicitGeometry* implicitGeom, const std::string& id)
+    void CityGMLFactory::requestSharedGeometryWithID(ImplicitGeometry* implicitGeom, const std::string& id, const DocumentPosition& position)
     {
-        m_geometryManager->requestSharedGeometryForImplicitGeometry(implicitGeom, id);
+        m_geometryManager->requestSharedGeometryForImplicitGeometry(implicitGeom, id, position);
     }
 
-    std::shared_ptr<Texture> CityGMLFactory::createTexture(const std::string& id)
+    std::shared_ptr<Texture> CityGMLFactory::createTexture(const ObjectID& id)
     {
-        std::shared_ptr<Texture> tex = std::shared_ptr<Texture>(new Texture(id));
+        std::shared_ptr<Texture> tex = ObjectArena::share(new (m_arena) Texture(id));
         m_appearanceManager->addAppearance(tex);
         return tex;
     }
 
-    std::shared_ptr<Material> CityGMLFactory::createMaterial(const std::string& id)
+    std::shared_ptr<Material> CityGMLFactory::createMaterial(const ObjectID& id)
     {
-        std::shared_ptr<Material> mat = std::shared_ptr<Material>(new Material(id));
+        std::shared_ptr<Material> mat = ObjectArena::share(new (m_arena) Material(id));
         m_appearanceManager->addAppearance(mat);
         return mat;
     }
 
-    std::shared_ptr<GeoreferencedTexture> CityGMLFactory::createGeoReferencedTexture(const std::string& id)
+    std::shared_ptr<GeoreferencedTexture> CityGMLFactory::createGeoReferencedTexture(const ObjectID& id)
     {
-        std::shared_ptr<GeoreferencedTexture> tex = std::shared_ptr<GeoreferencedTexture>(new GeoreferencedTexture(id));
+        std::shared_ptr<GeoreferencedTexture> tex = ObjectArena::share(new (m_arena) GeoreferencedTexture(id));
         m_appearanceManager->addAppearance(tex);
         return tex;
     }
 
-    std::shared_ptr<MaterialTargetDefinition> CityGMLFactory::createMaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const std::string& id)
+    std::shared_ptr<MaterialTargetDefinition> CityGMLFactory::createMaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const ObjectID& id, const DocumentPosition& position)
     {
-        std::shared_ptr<MaterialTargetDefinition> targetDef = std::shared_ptr<MaterialTargetDefinition>(new MaterialTargetDefinition(targetID, appearance, id));
-        m_appearanceManager->addMaterialTargetDefinition(targetDef);
+        std::shared_ptr<MaterialTargetDefinition> targetDef = ObjectArena::share(new (m_arena) MaterialTargetDefinition(targetID, appearance, id));
+        m_appearanceManager->addMaterialTargetDefinition(targetDef, position);
         return targetDef;
     }
 
-    std::shared_ptr<TextureTargetDefinition> CityGMLFactory::createTextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const std::string& id)
+    std::shared_ptr<TextureTargetDefinition> CityGMLFactory::createTextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const ObjectID& id, const DocumentPosition& position)
     {
-        std::shared_ptr<TextureTargetDefinition> targetDef = std::shared_ptr<TextureTargetDefinition>(new TextureTargetDefinition(targetID, appearance, id));
-        m_appearanceManager->addTextureTargetDefinition(targetDef);
+        std::shared_ptr<TextureTargetDefinition> targetDef = ObjectArena::share(new (m_arena) TextureTargetDefinition(targetID, appearance, id));
+        m_appearanceManager->addTextureTargetDefinition(targetDef, position);
         return targetDef;
     }
 
@@ -158,15 +168,110 @@ namespace citygml {
         return m_appearanceManager->getAllThemes();
     }
 
+    namespace {
+
+        void collectAppearanceTargets(Geometry& geom, std::vector<AppearanceTarget*>& targets, std::vector<Polygon*>& polygons)
+        {
+            targets.push_back(&geom);
+
+            for (unsigned int i = 0; i < geom.getPolygonsCount(); i++) {
+                polygons.push_back(geom.getPolygon(i).get());
+                targets.push_back(polygons.back());
+            }
+
+            for (unsigned int i = 0; i < geom.getGeometriesCount(); i++) {
+                collectAppearanceTargets(geom.getGeometry(i), targets, polygons);
+            }
+        }
+
+        void collectAppearanceTargets(CityObject& obj, std::vector<AppearanceTarget*>& targets, std::vector<Polygon*>& polygons)
+        {
+            for (unsigned int i = 0; i < obj.getGeometriesCount(); i++) {
+                collectAppearanceTargets(obj.getGeometry(i), targets, polygons);
+            }
+
+            for (unsigned int i = 0; i < obj.getImplicitGeometryCount(); i++) {
+                ImplicitGeometry& implicitGeom = obj.getImplicitGeometry(i);
+                for (unsigned int j = 0; j < implicitGeom.getGeometriesCount(); j++) {
+                    collectAppearanceTargets(implicitGeom.getGeometry(j), targets, polygons);
+                }
+            }
+
+            for (unsigned int i = 0; i < obj.getChildCityObjectsCount(); i++) {
+                collectAppearanceTargets(obj.getChildCityObject(i), targets, polygons);
+            }
+        }
+
+    }
+
+    bool CityGMLFactory::closeCityObject(CityObject& obj)
+    {
+        // The polygons of the object before resolving the shared polygon requests
+        std::vector<AppearanceTarget*> targets;
+        std::vector<Polygon*> polygons;
+        collectAppearanceTargets(obj, targets, polygons);
+
+        const bool geometriesResolved = m_geometryManager->finishRecentRequests();
+        if (!m_polygonManager->finishRecentRequests(polygons) || !geometriesResolved) {
+            return false;
+        }
+
+        // Collect again to include the geometries of implicit geometries that were resolved right now
+        targets.clear();
+        polygons.clear();
+        collectAppearanceTargets(obj, targets, polygons);
+
+        m_appearanceManager->assignAppearancesToTargets(targets);
+        return true;
+    }
+
+    void CityGMLFactory::mergeFactory(CityGMLFactory& other)
+    {
+        m_polygonManager->merge(*other.m_polygonManager);
+        m_geometryManager->merge(*other.m_geometryManager);
+        m_appearanceManager->merge(*other.m_appearanceManager);
+    }
+
+    void CityGMLFactory::mergeCityModels(CityModel& model, CityModel& other)
+    {
+        for (std::unique_ptr<CityObject>& obj : other.m_roots) {
+            model.m_roots.push_back(std::move(obj));
+        }
+        other.m_roots.clear();
+
+        if (!model.getEnvelope().validBounds() && other.getEnvelope().validBounds()) {
+            model.m_envelope.swap(other.m_envelope);
+        }
+
+        for (const auto& attribute : other.getAttributes()) {
+            model.getAttributes().insert(attribute);
+        }
+    }
+
     void CityGMLFactory::closeFactory()
     {
+        CITYGML_TRACE_SCOPE("close factory");
+
         m_polygonManager->finish();
         m_geometryManager->finish();
         m_appearanceManager->assignAppearancesToTargets();
     }
 
+    size_t CityGMLFactory::getResolvedXLinksCount() const
+    {
+        return m_polygonManager->getResolvedRequestsCount() + m_geometryManager->getResolvedRequestsCount();
+    }
+
+    size_t CityGMLFactory::getUnresolvedXLinksCount() const
+    {
+        return m_polygonManager->getUnresolvedRequestsCount() + m_geometryManager->getUnresolvedRequestsCount();
+    }
+
     CityGMLFactory::~CityGMLFactory()
     {
+        if (m_arena != nullptr) {
+            m_arena->releaseReference();
+        }
 
     }
 
@@ -21,6 +21,11 @@
 #include <citygml/appearancemanager.h>
 #include <citygml/appearance.h>
 #include <citygml/citygmllogger.h>
+#include <citygml/polygon.h>
+#include <citygml/implictgeometry.h>
+#include <citygml/vertexpool.h>
+#include <citygml/tesselatorbase.h>
+#include <citygml/tracing.h>
 
 #include <float.h>
 #include <string.h>
@@ -28,6 +33,9 @@
 
 #include <iterator>
 #include <set>
+#include <atomic>
+#include <thread>
+#include <exception>
 
 #ifndef min
 #	define min( a, b ) ( ( ( a ) < ( b ) ) ? ( a ) : ( b ) )
@@ -37,7 +45,7 @@
 
 namespace citygml
 {
-    CityModel::CityModel(const std::string& id) : FeatureObject( id )
+    CityModel::CityModel(const ObjectID& id) : FeatureObject( id )
     {
 
     }
@@ -115,11 +123,88 @@ namespace citygml
     }
 
 
-    void CityModel::finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    void CityModel::finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger, unsigned int threadCount)
     {
-        // Finish all cityobjcts
+        CITYGML_TRACE_SCOPE("finish CityModel");
+
+        // Collect the polygons of all cityobjects. This broadcasts the appearances of the geometries to their polygons which
+        // must be done before the polygons are finished and can not be done concurrently (geometries and polygons may be shared).
+        // rootPolygonsEnd[i] is the end of the polygons of the i-th root object
+        std::vector<Polygon*> polygons;
+        std::vector<size_t> rootPolygonsEnd;
+        rootPolygonsEnd.reserve(m_roots.size());
         for (auto& cityObj : m_roots) {
-            cityObj->finish(tesselator, optimize, logger);
+            cityObj->prepareFinish(polygons);
+            rootPolygonsEnd.push_back(polygons.size());
+        }
+
+        // The polygons are distributed in chunks to keep the synchronization overhead low
+        const size_t chunkSize = 64;
+        const size_t chunks = (polygons.size() + chunkSize - 1) / chunkSize;
+
+        if (threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        if (threadCount > chunks) {
+            threadCount = static_cast<unsigned int>(chunks);
+        }
+
+        if (threadCount <= 1) {
+            size_t polygon = 0;
+            for (size_t i = 0; i < m_roots.size(); i++) {
+                CITYGML_TRACE_SCOPE_DETAIL("finish CityObject", m_roots[i]->getId());
+                for (; polygon < rootPolygonsEnd[i]; polygon++) {
+                    polygons[polygon]->finish(tesselator, optimize, logger);
+                }
+            }
+        } else {
+            CITYGML_LOG_DEBUG(logger, "Finishing " << polygons.size() << " polygons using " << threadCount << " threads.");
+
+            std::atomic<size_t> nextPolygon(0);
+            std::vector<std::exception_ptr> errors(threadCount);
+
+            // Polygons are finished only once even if they are collected multiple times (shared polygons)
+            auto finishPolygons = [&](TesselatorBase& threadTesselator, std::exception_ptr& error) {
+                CITYGML_TRACE_SCOPE("finish polygons");
+                try {
+                    for (size_t begin = nextPolygon.fetch_add(chunkSize); begin < polygons.size(); begin = nextPolygon.fetch_add(chunkSize)) {
+                        const size_t end = begin + chunkSize < polygons.size() ? begin + chunkSize : polygons.size();
+                        for (size_t i = begin; i < end; i++) {
+                            polygons[i]->finish(threadTesselator, optimize, logger);
+                        }
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            };
+
+            std::vector<std::unique_ptr<TesselatorBase> > tesselators;
+            std::vector<std::thread> threads;
+            for (unsigned int i = 1; i < threadCount; i++) {
+                tesselators.push_back(tesselator.clone());
+                threads.push_back(std::thread(finishPolygons, std::ref(*tesselators.back()), std::ref(errors[i])));
+            }
+
+            // The calling thread works as well
+            finishPolygons(tesselator, errors[0]);
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            for (const std::exception_ptr& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        // The polygons are merged after all polygons are finished as polygons may be shared between objects
+        if (optimize) {
+            CITYGML_TRACE_SCOPE("merge polygons");
+            for (auto& cityObj : m_roots) {
+                cityObj->mergePolygons(logger);
+            }
         }
 
         // Build city objects map
@@ -128,6 +213,116 @@ namespace citygml
         }
     }
 
+    namespace {
+
+        void collectPolygons(Geometry& geom, std::vector<Polygon*>& polygons)
+        {
+            for (unsigned int i = 0; i < geom.getPolygonsCount(); i++) {
+                polygons.push_back(geom.getPolygon(i).get());
+            }
+
+            for (unsigned int i = 0; i < geom.getGeometriesCount(); i++) {
+                collectPolygons(geom.getGeometry(i), polygons);
+            }
+        }
+
+        void collectPolygons(CityObject& obj, std::vector<Polygon*>& polygons)
+        {
+            for (unsigned int i = 0; i < obj.getGeometriesCount(); i++) {
+                collectPolygons(obj.getGeometry(i), polygons);
+            }
+
+            for (unsigned int i = 0; i < obj.getImplicitGeometryCount(); i++) {
+                ImplicitGeometry& implicitGeom = obj.getImplicitGeometry(i);
+                for (unsigned int j = 0; j < implicitGeom.getGeometriesCount(); j++) {
+                    collectPolygons(implicitGeom.getGeometry(j), polygons);
+                }
+            }
+
+            for (unsigned int i = 0; i < obj.getChildCityObjectsCount(); i++) {
+                collectPolygons(obj.getChildCityObject(i), polygons);
+            }
+        }
+
+    }
+
+    void CityModel::createWeldedMeshes(double tolerance)
+    {
+        CITYGML_TRACE_SCOPE("weld vertices");
+
+        for (auto& cityObj : m_roots) {
+            cityObj->createWeldedMeshes(m_themes, tolerance);
+        }
+    }
+
+    void CityModel::createVertexPool(bool compact)
+    {
+        if (m_vertexPool != nullptr) {
+            return;
+        }
+
+        CITYGML_TRACE_SCOPE("create vertex pool");
+
+        // The polygons are visited in document order, hence the polygons of a CityObject are adjacent in the pool.
+        // rootPolygonsEnd[i] is the end of the polygons of the i-th root object
+        std::vector<Polygon*> polygons;
+        std::vector<size_t> rootPolygonsEnd;
+        rootPolygonsEnd.reserve(m_roots.size());
+        for (auto& cityObj : m_roots) {
+            collectPolygons(*cityObj, polygons);
+            rootPolygonsEnd.push_back(polygons.size());
+        }
+
+        // Reserve the lists at once (shared polygons are counted several times, they are moved only once)
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        for (const Polygon* polygon : polygons) {
+            vertexCount += polygon->getVertexCount();
+            indexCount += polygon->getIndexCount();
+        }
+
+        m_vertexPool = std::make_shared<VertexPool>(compact);
+        if (compact) {
+            m_vertexPool->getLocalPositions().reserve(vertexCount);
+            m_vertexPool->getShortIndices().reserve(indexCount);
+        } else {
+            m_vertexPool->getPositions().reserve(vertexCount);
+            m_vertexPool->getIndices().reserve(indexCount);
+        }
+
+        size_t polygon = 0;
+        for (size_t i = 0; i < m_roots.size(); i++) {
+            size_t originIndex = 0;
+            if (compact) {
+                // The vertices of a root object are stored relative to the center of their bounding box which keeps the single precision
+                // offsets small. Polygons shared with previous objects are already moved and have no own vertices anymore.
+                TVec3d lower(DBL_MAX, DBL_MAX, DBL_MAX);
+                TVec3d upper(-DBL_MAX, -DBL_MAX, -DBL_MAX);
+                for (size_t j = polygon; j < rootPolygonsEnd[i]; j++) {
+                    for (const TVec3d& vertex : polygons[j]->getVertexSpan()) {
+                        lower = TVec3d((std::min)(lower.x, vertex.x), (std::min)(lower.y, vertex.y), (std::min)(lower.z, vertex.z));
+                        upper = TVec3d((std::max)(upper.x, vertex.x), (std::max)(upper.y, vertex.y), (std::max)(upper.z, vertex.z));
+                    }
+                }
+                originIndex = m_vertexPool->addOrigin(lower.x <= upper.x ? (lower + upper) * 0.5 : TVec3d(0.0, 0.0, 0.0));
+            }
+
+            for (; polygon < rootPolygonsEnd[i]; polygon++) {
+                polygons[polygon]->moveToVertexPool(m_vertexPool, originIndex);
+            }
+        }
+    }
+
+    std::shared_ptr<const VertexPool> CityModel::getVertexPool() const
+    {
+        return m_vertexPool;
+    }
+
+    std::shared_ptr<VertexPool> CityModel::getVertexPool()
+    {
+        return m_vertexPool;
+    }
+
     std::ostream& operator<<( std::ostream& out, const CityModel& model )
     {
         out << "Root CityObjects: " << std::endl;
@@ -1,19 +1,32 @@
 #include <citygml/cityobject.h>
 #include <citygml/geometry.h>
 #include <citygml/implictgeometry.h>
+#include <citygml/polygon.h>
 #include <citygml/appearancemanager.h>
 #include <citygml/citygml.h>
 #include <citygml/citygmllogger.h>
+#include <citygml/tracing.h>
 #include <citygml/address.h>
 
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
 
 ENUM_CLASS_BITWISE_OPERATORS(citygml::CityObject::CityObjectsType);
 
 namespace citygml {
 
-    CityObject::CityObject(const std::string& id, CityObject::CityObjectsType type)  : FeatureObject( id ), m_type( type )
+    namespace {
+        void collectGeometries(Geometry& geom, std::vector<Geometry*>& geometries)
+        {
+            geometries.push_back(&geom);
+            for (unsigned int i = 0; i < geom.getGeometriesCount(); i++) {
+                collectGeometries(geom.getGeometry(i), geometries);
+            }
+        }
+    }
+
+    CityObject::CityObject(const ObjectID& id, CityObject::CityObjectsType type)  : FeatureObject( id ), m_type( type )
     {
 
     }
@@ -98,20 +111,123 @@ namespace citygml {
         m_address = std::move(address);
     }
 
-    void CityObject::finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    void CityObject::finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    {
+        CITYGML_TRACE_SCOPE_DETAIL("finish CityObject", getId());
+
+        std::vector<Polygon*> polygons;
+        prepareFinish(polygons);
+
+        for (Polygon* polygon : polygons) {
+            polygon->finish(tesselator, optimize, logger);
+        }
+
+        if (optimize) {
+            mergePolygons(logger);
+        }
+    }
+
+    void CityObject::prepareFinish(std::vector<Polygon*>& polygons)
     {
         for (std::unique_ptr<Geometry>& geom : m_geometries) {
-            geom->finish(tesselator, optimize, logger);
+            geom->prepareFinish(polygons);
         }
 
         for (std::unique_ptr<ImplicitGeometry>& implictGeom : m_implicitGeometries) {
             for (int i = 0; i < implictGeom->getGeometriesCount(); i++) {
-                implictGeom->getGeometry(i).finish(tesselator, optimize, logger);
+                implictGeom->getGeometry(i).prepareFinish(polygons);
+            }
+        }
+
+        for (std::unique_ptr<CityObject>& child : m_children) {
+            child->prepareFinish(polygons);
+        }
+    }
+
+    void CityObject::mergePolygons(std::shared_ptr<CityGMLLogger> logger)
+    {
+        std::vector<Geometry*> geometries;
+        for (std::unique_ptr<Geometry>& geom : m_geometries) {
+            collectGeometries(*geom, geometries);
+        }
+
+        // Every LOD is merged on its own as polygons may be shared between the geometries of different LODs
+        std::vector<unsigned int> lods;
+        for (Geometry* geom : geometries) {
+            if (std::find(lods.begin(), lods.end(), geom->getLOD()) == lods.end()) {
+                lods.push_back(geom->getLOD());
+            }
+        }
+
+        for (unsigned int lod : lods) {
+            // Polygons may occur several times (shared polygons), they are merged only once
+            std::unordered_set<const Polygon*> visited;
+            std::vector<std::vector<std::shared_ptr<const Polygon> > > groups;
+            for (Geometry* geom : geometries) {
+                if (geom->getLOD() != lod) {
+                    continue;
+                }
+
+                for (unsigned int i = 0; i < geom->getPolygonsCount(); i++) {
+                    std::shared_ptr<const Polygon> polygon = geom->getPolygon(i);
+                    if (polygon->getIndexCount() == 0 || !visited.insert(polygon.get()).second) {
+                        continue;
+                    }
+
+                    auto group = std::find_if(groups.begin(), groups.end(), [&](const std::vector<std::shared_ptr<const Polygon> >& candidate) {
+                        return candidate.front()->hasSameAppearancesAs(*polygon);
+                    });
+                    if (group == groups.end()) {
+                        groups.push_back(std::vector<std::shared_ptr<const Polygon> >());
+                        group = groups.end() - 1;
+                    }
+                    group->push_back(polygon);
+                }
+            }
+
+            // The merged polygon replaces the first polygon of its group, the other polygons are removed
+            std::unordered_map<const Polygon*, std::shared_ptr<Polygon> > replacements;
+            for (const std::vector<std::shared_ptr<const Polygon> >& group : groups) {
+                if (group.size() < 2) {
+                    continue;
+                }
+
+                replacements[group.front().get()] = Polygon::merge(group, logger);
+                for (size_t i = 1; i < group.size(); i++) {
+                    replacements[group[i].get()] = nullptr;
+                }
+            }
+
+            if (replacements.empty()) {
+                continue;
+            }
+
+            for (Geometry* geom : geometries) {
+                if (geom->getLOD() == lod) {
+                    geom->replacePolygons(replacements);
+                }
+            }
+        }
+
+        for (std::unique_ptr<CityObject>& child : m_children) {
+            child->mergePolygons(logger);
+        }
+    }
+
+    void CityObject::createWeldedMeshes(const std::vector<std::string>& themes, double tolerance)
+    {
+        for (std::unique_ptr<Geometry>& geom : m_geometries) {
+            geom->createWeldedMeshes(themes, tolerance);
+        }
+
+        for (std::unique_ptr<ImplicitGeometry>& implictGeom : m_implicitGeometries) {
+            for (unsigned int i = 0; i < implictGeom->getGeometriesCount(); i++) {
+                implictGeom->getGeometry(i).createWeldedMeshes(themes, tolerance);
             }
         }
 
         for (std::unique_ptr<CityObject>& child : m_children) {
-            child->finish(tesselator, optimize, logger);
+            child->createWeldedMeshes(themes, tolerance);
         }
     }
 
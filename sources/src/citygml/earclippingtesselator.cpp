@@ -0,0 +1,587 @@
+/* -*-c++-*- libcitygml
+*
+* This file is part of libcitygml library
+* http://code.google.com/p/libcitygml
+*
+* libcitygml is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 2.1 of the License, or
+* (at your option) any later version.
+*
+* libcitygml is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* The ear clipping algorithm is a port of earcut (https://github.com/mapbox/earcut), which is distributed under the
+* following license:
+*
+* ISC License
+*
+* Copyright (c) 2016, Mapbox
+*
+* Permission to use, copy, modify, and/or distribute this software for any purpose
+* with or without fee is hereby granted, provided that the above copyright notice
+* and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH REGARD TO
+* THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+* IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+* DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+* WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <citygml/earclippingtesselator.h>
+#include <citygml/citygmllogger.h>
+
+#include <algorithm>
+#include <limits>
+#include <math.h>
+
+// The implementation is a port of the earcut library (https://github.com/mapbox/earcut), see the license notice above.
+// All rings are oriented so that the exterior ring is counter clockwise in the projection plane; area(p, q, r) is
+// positive for counter clockwise (convex) corners.
+
+namespace {
+
+    inline bool pointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py)
+    {
+        return (cx - px) * (ay - py) >= (ax - px) * (cy - py)
+            && (ax - px) * (by - py) >= (bx - px) * (ay - py)
+            && (bx - px) * (cy - py) >= (cx - px) * (by - py);
+    }
+
+    inline int sign(double value)
+    {
+        return value > 0.0 ? 1 : (value < 0.0 ? -1 : 0);
+    }
+
+}
+
+EarClippingTesselator::EarClippingTesselator(std::shared_ptr<citygml::CityGMLLogger> logger)
+    : TesselatorBase( logger )
+    , _axisU( 0 )
+    , _axisV( 1 )
+{
+
+}
+
+EarClippingTesselator::~EarClippingTesselator()
+{
+
+}
+
+std::unique_ptr<TesselatorBase> EarClippingTesselator::clone() const
+{
+    std::unique_ptr<TesselatorBase> tesselator(new EarClippingTesselator(_logger));
+    tesselator->setKeepVertices(_keepVertices);
+    tesselator->setConvexFastPath(_convexFastPath);
+    return tesselator;
+}
+
+void EarClippingTesselator::compute()
+{
+    _nodes.clear();
+
+    if (_contourBegins.empty()) {
+        return;
+    }
+
+    // Project on the plane orthogonal to the dominant axis of the normal. The axes are chosen so that rings that are
+    // counter clockwise with respect to the normal are counter clockwise in the projection plane.
+    const double nx = fabs(_normal.x);
+    const double ny = fabs(_normal.y);
+    const double nz = fabs(_normal.z);
+    if (nx > ny && nx > nz) {
+        _axisU = _normal.x > 0 ? 1 : 2;
+        _axisV = _normal.x > 0 ? 2 : 1;
+    } else if (ny > nz) {
+        _axisU = _normal.y > 0 ? 2 : 0;
+        _axisV = _normal.y > 0 ? 0 : 2;
+    } else {
+        _axisU = _normal.z >= 0 ? 0 : 1;
+        _axisV = _normal.z >= 0 ? 1 : 0;
+    }
+
+    // Coordinates relative to the first vertex keep the precision of georeferenced coordinates
+    _origin = _vertices.front();
+
+    const unsigned int outerEnd = _contourBegins.size() > 1 ? _contourBegins[1] : _vertices.size();
+    int outerNode = createRing(_contourBegins[0], outerEnd, true);
+    if (outerNode < 0 || _nodes[outerNode].next == _nodes[outerNode].prev) {
+        return;
+    }
+
+    if (_contourBegins.size() > 1) {
+        outerNode = eliminateHoles(outerNode);
+    }
+
+    clipEars(outerNode, 0);
+}
+
+int EarClippingTesselator::createRing(unsigned int begin, unsigned int end, bool counterClockwise)
+{
+    double signedArea = 0.0;
+    for (unsigned int i = begin, j = end - 1; i < end; j = i++) {
+        signedArea += (_vertices[j][_axisU] - _vertices[i][_axisU]) * (_vertices[i][_axisV] + _vertices[j][_axisV]);
+    }
+
+    int last = -1;
+    if (counterClockwise == (signedArea > 0)) {
+        for (unsigned int i = begin; i < end; i++) {
+            last = insertNode(i, last);
+        }
+    } else {
+        for (unsigned int i = end; i > begin; i--) {
+            last = insertNode(i - 1, last);
+        }
+    }
+
+    // The ring is closed by a duplicate of the first vertex in most documents
+    if (last >= 0 && equals(last, _nodes[last].next)) {
+        int next = _nodes[last].next;
+        removeNode(last);
+        last = next;
+    }
+
+    return last;
+}
+
+int EarClippingTesselator::insertNode(unsigned int vertex, int last)
+{
+    Node node;
+    node.vertex = vertex;
+    node.x = _vertices[vertex][_axisU] - _origin[_axisU];
+    node.y = _vertices[vertex][_axisV] - _origin[_axisV];
+
+    const int index = static_cast<int>(_nodes.size());
+    if (last < 0) {
+        node.prev = index;
+        node.next = index;
+    } else {
+        node.next = _nodes[last].next;
+        node.prev = last;
+        _nodes[_nodes[last].next].prev = index;
+        _nodes[last].next = index;
+    }
+
+    _nodes.push_back(node);
+    return index;
+}
+
+void EarClippingTesselator::removeNode(int node)
+{
+    _nodes[_nodes[node].next].prev = _nodes[node].prev;
+    _nodes[_nodes[node].prev].next = _nodes[node].next;
+}
+
+int EarClippingTesselator::splitPolygon(int a, int b)
+{
+    // Links a and b with a bridge. If a and b are in the same ring the ring is split in two, if they are in different
+    // rings the rings are merged. Returns the copy of b.
+    const int a2 = static_cast<int>(_nodes.size());
+    const int b2 = a2 + 1;
+    _nodes.push_back(_nodes[a]);
+    _nodes.push_back(_nodes[b]);
+
+    const int an = _nodes[a].next;
+    const int bp = _nodes[b].prev;
+
+    _nodes[a].next = b;
+    _nodes[b].prev = a;
+
+    _nodes[a2].next = an;
+    _nodes[an].prev = a2;
+
+    _nodes[b2].next = a2;
+    _nodes[a2].prev = b2;
+
+    _nodes[bp].next = b2;
+    _nodes[b2].prev = bp;
+
+    return b2;
+}
+
+int EarClippingTesselator::filterPoints(int start, int end)
+{
+    // Removes duplicate and collinear points
+    if (start < 0) {
+        return start;
+    }
+    if (end < 0) {
+        end = start;
+    }
+
+    int p = start;
+    bool again;
+    do {
+        again = false;
+
+        if (equals(p, _nodes[p].next) || area(_nodes[p].prev, p, _nodes[p].next) == 0.0) {
+            removeNode(p);
+            p = end = _nodes[p].prev;
+            if (p == _nodes[p].next) {
+                break;
+            }
+            again = true;
+        } else {
+            p = _nodes[p].next;
+        }
+    } while (again || p != end);
+
+    return end;
+}
+
+int EarClippingTesselator::getLeftmost(int start) const
+{
+    int p = start;
+    int leftmost = start;
+    do {
+        if (_nodes[p].x < _nodes[leftmost].x || (_nodes[p].x == _nodes[leftmost].x && _nodes[p].y < _nodes[leftmost].y)) {
+            leftmost = p;
+        }
+        p = _nodes[p].next;
+    } while (p != start);
+
+    return leftmost;
+}
+
+int EarClippingTesselator::eliminateHoles(int outerNode)
+{
+    std::vector<int> holes;
+    for (size_t i = 1; i < _contourBegins.size(); i++) {
+        const unsigned int end = i + 1 < _contourBegins.size() ? _contourBegins[i + 1] : _vertices.size();
+        const int list = createRing(_contourBegins[i], end, false);
+        if (list >= 0) {
+            holes.push_back(getLeftmost(list));
+        }
+    }
+
+    // Process the holes from left to right
+    std::sort(holes.begin(), holes.end(), [this](int a, int b) {
+        return _nodes[a].x < _nodes[b].x || (_nodes[a].x == _nodes[b].x && _nodes[a].y < _nodes[b].y);
+    });
+
+    for (int hole : holes) {
+        outerNode = eliminateHole(hole, outerNode);
+    }
+
+    return outerNode;
+}
+
+int EarClippingTesselator::eliminateHole(int hole, int outerNode)
+{
+    const int bridge = findHoleBridge(hole, outerNode);
+    if (bridge < 0) {
+        CITYGML_LOG_WARN_TYPE(_logger, citygml::CityGMLLogger::WARNINGTYPE::WT_TESSELATION_FAILED, "EarClippingTesselator: could not connect interior ring to the exterior ring. The interior ring is ignored.");
+        return outerNode;
+    }
+
+    const int bridgeReverse = splitPolygon(bridge, hole);
+
+    // filter collinear points around the cuts
+    filterPoints(bridgeReverse, _nodes[bridgeReverse].next);
+    return filterPoints(bridge, _nodes[bridge].next);
+}
+
+int EarClippingTesselator::findHoleBridge(int hole, int outerNode)
+{
+    // David Eberly's algorithm for finding a bridge between a hole and the outer ring
+    const double hx = _nodes[hole].x;
+    const double hy = _nodes[hole].y;
+    double qx = -std::numeric_limits<double>::infinity();
+    int m = -1;
+
+    // Find a segment intersected by a ray from the hole's leftmost point to the left. The segment's endpoint with the
+    // lesser x will be the potential connection point
+    int p = outerNode;
+    do {
+        const Node& node = _nodes[p];
+        const Node& next = _nodes[node.next];
+        if (hy <= node.y && hy >= next.y && next.y != node.y) {
+            const double x = node.x + (hy - node.y) * (next.x - node.x) / (next.y - node.y);
+            if (x <= hx && x > qx) {
+                qx = x;
+                m = node.x < next.x ? p : node.next;
+                if (x == hx) {
+                    // the hole touches the outer segment, pick the leftmost endpoint
+                    return m;
+                }
+            }
+        }
+        p = node.next;
+    } while (p != outerNode);
+
+    if (m < 0) {
+        return -1;
+    }
+
+    // Look for points inside the triangle of the hole point, the segment intersection and the endpoint. If there are no
+    // points found the connection is valid, otherwise choose the point with the minimum angle to the ray as connection point
+    const int stop = m;
+    const double mx = _nodes[m].x;
+    const double my = _nodes[m].y;
+    double tanMin = std::numeric_limits<double>::infinity();
+
+    p = m;
+    do {
+        const Node& node = _nodes[p];
+        if (hx >= node.x && node.x >= mx && hx != node.x
+                && pointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, node.x, node.y)) {
+
+            const double tan = fabs(hy - node.y) / (hx - node.x);
+
+            if (locallyInside(p, hole)
+                    && (tan < tanMin || (tan == tanMin && (node.x > _nodes[m].x || (node.x == _nodes[m].x && sectorContainsSector(m, p)))))) {
+                m = p;
+                tanMin = tan;
+            }
+        }
+        p = node.next;
+    } while (p != stop);
+
+    return m;
+}
+
+void EarClippingTesselator::clipEars(int ear, int pass)
+{
+    if (ear < 0) {
+        return;
+    }
+
+    int stop = ear;
+
+    while (_nodes[ear].prev != _nodes[ear].next) {
+        const int prev = _nodes[ear].prev;
+        const int next = _nodes[ear].next;
+
+        if (isEar(ear)) {
+            addTriangle(prev, ear, next);
+            removeNode(ear);
+
+            // skipping the next vertex leads to less sliver triangles
+            ear = _nodes[next].next;
+            stop = _nodes[next].next;
+            continue;
+        }
+
+        ear = next;
+
+        // No ear found in a whole pass over the remaining ring
+        if (ear == stop) {
+            if (pass == 0) {
+                // try again after removing duplicate and collinear points
+                clipEars(filterPoints(ear), 1);
+            } else if (pass == 1) {
+                // the ring is probably self intersecting... try to cure small local self intersections
+                clipEars(cureLocalIntersections(filterPoints(ear)), 2);
+            } else if (pass == 2) {
+                // as a last resort split the ring in two and triangulate them separately
+                splitAndClipEars(ear);
+            }
+            break;
+        }
+    }
+}
+
+bool EarClippingTesselator::isEar(int ear) const
+{
+    const int a = _nodes[ear].prev;
+    const int b = ear;
+    const int c = _nodes[ear].next;
+
+    if (area(a, b, c) <= 0.0) {
+        return false; // reflex or collinear, can't be an ear
+    }
+
+    // the ear must not contain any reflex point of the ring
+    const Node& na = _nodes[a];
+    const Node& nb = _nodes[b];
+    const Node& nc = _nodes[c];
+
+    int p = nc.next;
+    while (p != a) {
+        const Node& np = _nodes[p];
+        if (!(np.x == na.x && np.y == na.y)
+                && pointInTriangle(na.x, na.y, nb.x, nb.y, nc.x, nc.y, np.x, np.y)
+                && area(np.prev, p, np.next) <= 0.0) {
+            return false;
+        }
+        p = np.next;
+    }
+
+    return true;
+}
+
+int EarClippingTesselator::cureLocalIntersections(int start)
+{
+    if (start < 0) {
+        return start;
+    }
+
+    int p = start;
+    do {
+        const int a = _nodes[p].prev;
+        const int b = _nodes[_nodes[p].next].next;
+
+        if (!equals(a, b) && intersects(a, p, _nodes[p].next, b) && locallyInside(a, b) && locallyInside(b, a)) {
+            addTriangle(a, p, b);
+
+            // remove the two nodes involved
+            const int pNext = _nodes[p].next;
+            removeNode(p);
+            removeNode(pNext);
+
+            p = start = b;
+        }
+        p = _nodes[p].next;
+    } while (p != start);
+
+    return filterPoints(p);
+}
+
+void EarClippingTesselator::splitAndClipEars(int start)
+{
+    // look for a valid diagonal that divides the ring into two
+    int a = start;
+    do {
+        int b = _nodes[_nodes[a].next].next;
+        while (b != _nodes[a].prev) {
+            if (_nodes[a].vertex != _nodes[b].vertex && isValidDiagonal(a, b)) {
+                int c = splitPolygon(a, b);
+
+                // filter colinear points around the cuts
+                a = filterPoints(a, _nodes[a].next);
+                c = filterPoints(c, _nodes[c].next);
+
+                clipEars(a, 0);
+                clipEars(c, 0);
+                return;
+            }
+            b = _nodes[b].next;
+        }
+        a = _nodes[a].next;
+    } while (a != start);
+}
+
+void EarClippingTesselator::addTriangle(int a, int b, int c)
+{
+    _outIndices.push_back(_nodes[a].vertex);
+    _outIndices.push_back(_nodes[b].vertex);
+    _outIndices.push_back(_nodes[c].vertex);
+}
+
+double EarClippingTesselator::area(int p, int q, int r) const
+{
+    const Node& np = _nodes[p];
+    const Node& nq = _nodes[q];
+    const Node& nr = _nodes[r];
+    return (nq.x - np.x) * (nr.y - nq.y) - (nq.y - np.y) * (nr.x - nq.x);
+}
+
+bool EarClippingTesselator::equals(int p, int q) const
+{
+    return _nodes[p].x == _nodes[q].x && _nodes[p].y == _nodes[q].y;
+}
+
+bool EarClippingTesselator::intersects(int p1, int q1, int p2, int q2) const
+{
+    // checks if the segments p1-q1 and p2-q2 intersect (including touching)
+    auto onSegment = [this](int p, int q, int r) {
+        const Node& np = _nodes[p];
+        const Node& nq = _nodes[q];
+        const Node& nr = _nodes[r];
+        return nq.x <= std::max(np.x, nr.x) && nq.x >= std::min(np.x, nr.x) && nq.y <= std::max(np.y, nr.y) && nq.y >= std::min(np.y, nr.y);
+    };
+
+    const int o1 = sign(area(p1, q1, p2));
+    const int o2 = sign(area(p1, q1, q2));
+    const int o3 = sign(area(p2, q2, p1));
+    const int o4 = sign(area(p2, q2, q1));
+
+    if (o1 != o2 && o3 != o4) return true; // general case
+
+    if (o1 == 0 && onSegment(p1, p2, q1)) return true; // p1, q1 and p2 are collinear and p2 lies on p1q1
+    if (o2 == 0 && onSegment(p1, q2, q1)) return true; // p1, q1 and q2 are collinear and q2 lies on p1q1
+    if (o3 == 0 && onSegment(p2, p1, q2)) return true; // p2, q2 and p1 are collinear and p1 lies on p2q2
+    if (o4 == 0 && onSegment(p2, q1, q2)) return true; // p2, q2 and q1 are collinear and q1 lies on p2q2
+
+    return false;
+}
+
+bool EarClippingTesselator::intersectsPolygon(int a, int b) const
+{
+    // checks if the diagonal a-b intersects any edge of the ring
+    const unsigned int va = _nodes[a].vertex;
+    const unsigned int vb = _nodes[b].vertex;
+
+    int p = a;
+    do {
+        const int next = _nodes[p].next;
+        const unsigned int vp = _nodes[p].vertex;
+        const unsigned int vn = _nodes[next].vertex;
+        if (vp != va && vn != va && vp != vb && vn != vb && intersects(p, next, a, b)) {
+            return true;
+        }
+        p = next;
+    } while (p != a);
+
+    return false;
+}
+
+bool EarClippingTesselator::locallyInside(int a, int b) const
+{
+    // checks if the diagonal a-b lies inside the ring in the neighbourhood of a
+    const int prev = _nodes[a].prev;
+    const int next = _nodes[a].next;
+    return area(prev, a, next) > 0.0 ?
+                area(a, b, next) <= 0.0 && area(a, prev, b) <= 0.0 :
+                area(a, b, prev) > 0.0 || area(a, next, b) > 0.0;
+}
+
+bool EarClippingTesselator::middleInside(int a, int b) const
+{
+    // checks if the middle of the diagonal a-b is inside the ring
+    const double px = (_nodes[a].x + _nodes[b].x) / 2.0;
+    const double py = (_nodes[a].y + _nodes[b].y) / 2.0;
+
+    bool inside = false;
+    int p = a;
+    do {
+        const Node& node = _nodes[p];
+        const Node& next = _nodes[node.next];
+        if (((node.y > py) != (next.y > py)) && next.y != node.y
+                && (px < (next.x - node.x) * (py - node.y) / (next.y - node.y) + node.x)) {
+            inside = !inside;
+        }
+        p = node.next;
+    } while (p != a);
+
+    return inside;
+}
+
+bool EarClippingTesselator::isValidDiagonal(int a, int b) const
+{
+    const Node& na = _nodes[a];
+    const Node& nb = _nodes[b];
+
+    if (_nodes[na.next].vertex == nb.vertex || _nodes[na.prev].vertex == nb.vertex || intersectsPolygon(a, b)) {
+        return false;
+    }
+
+    // locally visible and does not create opposite facing sectors
+    if (locallyInside(a, b) && locallyInside(b, a) && middleInside(a, b)
+            && (area(na.prev, a, nb.prev) != 0.0 || area(a, nb.prev, b) != 0.0)) {
+        return true;
+    }
+
+    // special zero length case
+    return equals(a, b) && area(na.prev, a, na.next) < 0.0 && area(nb.prev, b, nb.next) < 0.0;
+}
+
+bool EarClippingTesselator::sectorContainsSector(int m, int p) const
+{
+    // checks whether the sector in vertex m contains the sector in vertex p (both are at the same position)
+    return area(_nodes[m].prev, m, _nodes[p].prev) > 0.0 && area(_nodes[p].next, m, _nodes[m].next) > 0.0;
+}
@@ -4,7 +4,7 @@
 
 namespace citygml {
 
-    FeatureObject::FeatureObject(const std::string& gmlID) : Object(gmlID)
+    FeatureObject::FeatureObject(const ObjectID& gmlID) : Object(gmlID)
     {
         setEnvelope(new Envelope());
     }
@@ -1,14 +1,15 @@
 #include <citygml/geometry.h>
 
 #include <citygml/polygon.h>
+#include <citygml/weldedmesh.h>
 #include <citygml/appearancemanager.h>
 #include <citygml/appearance.h>
 #include <citygml/citygmllogger.h>
 
 namespace citygml {
 
-    Geometry::Geometry(const std::string& id, Geometry::GeometryType type, unsigned int lod)
-        : AppearanceTarget( id ), m_finished(false), m_type( type ), m_lod( lod )
+    Geometry::Geometry(const ObjectID& id, Geometry::GeometryType type, unsigned int lod)
+        : AppearanceTarget( id ), m_finished(false), m_type( type ), m_lod( lod ), m_welded(false)
     {
 
     }
@@ -126,25 +127,76 @@ namespace citygml {
         m_lineStrings.push_back(l);
     }
 
-    void Geometry::finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    void Geometry::finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    {
+        std::vector<Polygon*> polygons;
+        prepareFinish(polygons);
+
+        for (Polygon* polygon : polygons) {
+            polygon->finish(tesselator, optimize, logger);
+        }
+    }
+
+    void Geometry::prepareFinish(std::vector<Polygon*>& polygons)
     {
         // only need to finish geometry once
-        if (m_finished) {
+        if (m_finished.exchange(true)) {
             return;
         }
 
-        m_finished = true;
-
         for (std::shared_ptr<Geometry>&  child : m_childGeometries) {
             child->addTargetDefinitionsOf(*this);
-            child->finish(tesselator, optimize, logger);
+            child->prepareFinish(polygons);
         }
 
         for (std::shared_ptr<Polygon>& polygon : m_polygons) {
             polygon->addTargetDefinitionsOf(*this);
-            polygon->finish(tesselator, optimize, logger);
+            polygons.push_back(polygon.get());
         }
+    }
+
+    void Geometry::replacePolygons(std::unordered_map<const Polygon*, std::shared_ptr<Polygon> >& replacements)
+    {
+        std::vector<std::shared_ptr<Polygon> > polygons;
+        polygons.reserve(m_polygons.size());
+        for (std::shared_ptr<Polygon>& polygon : m_polygons) {
+            auto it = replacements.find(polygon.get());
+            if (it == replacements.end()) {
+                polygons.push_back(std::move(polygon));
+            } else if (it->second != nullptr) {
+                polygons.push_back(std::move(it->second));
+                it->second = nullptr;
+            }
+        }
+        m_polygons.swap(polygons);
+    }
 
+    void Geometry::createWeldedMeshes(const std::vector<std::string>& themes, double tolerance)
+    {
+        // shared geometries are welded only once
+        if (m_welded.exchange(true)) {
+            return;
+        }
+
+        std::vector<std::shared_ptr<const Polygon> > polygons;
+        collectPolygons(polygons);
+        m_weldedMeshes = WeldedMesh::create(polygons, themes, tolerance);
+    }
+
+    const std::vector<std::shared_ptr<const WeldedMesh> >& Geometry::getWeldedMeshes() const
+    {
+        return m_weldedMeshes;
+    }
+
+    void Geometry::collectPolygons(std::vector<std::shared_ptr<const Polygon> >& polygons) const
+    {
+        for (const std::shared_ptr<Geometry>& child : m_childGeometries) {
+            child->collectPolygons(polygons);
+        }
+
+        for (const std::shared_ptr<Polygon>& polygon : m_polygons) {
+            polygons.push_back(polygon);
+        }
     }
 
     std::ostream& operator<<( std::ostream& os, const citygml::Geometry& s )
@@ -153,7 +205,7 @@ namespace citygml {
         for ( unsigned int i = 0; i < s.getPolygonsCount(); i++ )
         {
             os << s.getPolygon(i);
-            count += s.getPolygon(i)->getVertices().size();
+            count += s.getPolygon(i)->getVertexCount();
         }
 
         os << "  @ " << s.getPolygonsCount() << " polys [" << count << " vertices]" << std::endl;
@@ -9,20 +9,68 @@ namespace citygml {
     GeometryManager::GeometryManager(std::shared_ptr<CityGMLLogger> logger)
     {
         m_logger = logger;
+        m_firstRecentRequest = 0;
+        m_resolvedRequests = 0;
+        m_unresolvedRequests = 0;
     }
 
     void GeometryManager::addSharedGeometry(std::shared_ptr<Geometry> geom)
     {
+        if (geom->hasGeneratedId()) {
+            // Geometries without gml:id can not be referenced
+            return;
+        }
+
         if (m_sharedGeometries.count(geom->getId()) > 0) {
-            CITYGML_LOG_WARN(m_logger, "Duplicate definition of shared geometry with id '" << geom->getId() << "'... overwriting existing object.");
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_DUPLICATE_ID, "Duplicate definition of shared geometry with id '" << geom->getId() << "'... overwriting existing object.");
         }
 
         m_sharedGeometries[geom->getId()] = geom;
     }
 
-    void GeometryManager::requestSharedGeometryForImplicitGeometry(ImplicitGeometry* geom, const std::string& geometryID)
+    void GeometryManager::requestSharedGeometryForImplicitGeometry(ImplicitGeometry* geom, const std::string& geometryID, const DocumentPosition& position)
     {
-        m_geometryRequests.push_back(GeometryRequest(geom, geometryID));
+        m_geometryRequests.push_back(GeometryRequest(geom, geometryID, position));
+    }
+
+    bool GeometryManager::finishRecentRequests()
+    {
+        size_t deferred = m_firstRecentRequest;
+        for (size_t i = m_firstRecentRequest; i < m_geometryRequests.size(); i++) {
+
+            auto it = m_sharedGeometries.find(m_geometryRequests[i].geometryID);
+            if (it == m_sharedGeometries.end()) {
+                m_geometryRequests[deferred++] = m_geometryRequests[i];
+                continue;
+            }
+
+            m_geometryRequests[i].target->addGeometry(it->second);
+            m_resolvedRequests++;
+        }
+
+        const bool resolved = deferred == m_firstRecentRequest;
+        m_geometryRequests.erase(m_geometryRequests.begin() + deferred, m_geometryRequests.end());
+        m_firstRecentRequest = deferred;
+        return resolved;
+    }
+
+    void GeometryManager::merge(GeometryManager& other)
+    {
+        for (auto& entry : other.m_sharedGeometries) {
+            addSharedGeometry(entry.second);
+        }
+
+        m_geometryRequests.insert(m_geometryRequests.end(), other.m_geometryRequests.begin(), other.m_geometryRequests.end());
+        m_firstRecentRequest = m_geometryRequests.size();
+
+        other.m_sharedGeometries.clear();
+        other.m_geometryRequests.clear();
+        other.m_firstRecentRequest = 0;
+
+        m_resolvedRequests += other.m_resolvedRequests;
+        m_unresolvedRequests += other.m_unresolvedRequests;
+        other.m_resolvedRequests = 0;
+        other.m_unresolvedRequests = 0;
     }
 
     void GeometryManager::finish()
@@ -32,21 +80,34 @@ namespace citygml {
 
             auto it = m_sharedGeometries.find(request.geometryID);
             if (it == m_sharedGeometries.end()) {
-                CITYGML_LOG_WARN(m_logger, "ImplicitGeometry object with id '" << request.target->getId() << "' requests Geometry with id '" << request.geometryID << "' but no such"
-                                 << "shared Geometry object exists.");
+                CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_UNRESOLVED_GEOMETRY_XLINK, "ImplicitGeometry object with id '" << request.target->getId() << "' requests Geometry with id '" << request.geometryID << "' but no such"
+                                 << " shared Geometry object exists (xlink at" << request.position << ").");
+                m_unresolvedRequests++;
                 continue;
             }
 
             request.target->addGeometry(it->second);
+            m_resolvedRequests++;
 
         }
 
         m_sharedGeometries.clear();
         m_geometryRequests.clear();
+        m_firstRecentRequest = 0;
 
         CITYGML_LOG_INFO(m_logger, "Finished processing shared geometry requests.");
     }
 
+    size_t GeometryManager::getResolvedRequestsCount() const
+    {
+        return m_resolvedRequests;
+    }
+
+    size_t GeometryManager::getUnresolvedRequestsCount() const
+    {
+        return m_unresolvedRequests;
+    }
+
     GeometryManager::~GeometryManager()
     {
 
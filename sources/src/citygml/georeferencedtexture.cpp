@@ -2,7 +2,7 @@
 
 namespace citygml {
 
-    GeoreferencedTexture::GeoreferencedTexture(const std::string& id) : Texture( id, "GeoreferencedTexture" ), m_preferWorldFile(true)
+    GeoreferencedTexture::GeoreferencedTexture(const ObjectID& id) : Texture( id, "GeoreferencedTexture" ), m_preferWorldFile(true)
     {
 
     }
@@ -3,7 +3,7 @@
 
 namespace citygml {
 
-    ImplicitGeometry::ImplicitGeometry(const std::string& id) : Object(id)
+    ImplicitGeometry::ImplicitGeometry(const ObjectID& id) : Object(id)
     {
 
     }
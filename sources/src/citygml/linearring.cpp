@@ -8,7 +8,7 @@
 
 namespace citygml {
 
-    LinearRing::LinearRing(const std::string& id, bool isExterior) : Object( id ), m_exterior( isExterior )
+    LinearRing::LinearRing(const ObjectID& id, bool isExterior) : Object( id ), m_exterior( isExterior )
     {
 
     }
@@ -47,6 +47,64 @@ namespace citygml {
         return n.normal();
     }
 
+    bool LinearRing::isConvex(const TVec3d& normal) const
+    {
+        size_t len = m_vertices.size();
+        if ( len > 1 && m_vertices.front() == m_vertices.back() ) {
+            len--; // ignore the closing vertex
+        }
+
+        const double normalLength = normal.length();
+        if ( len < 3 || normalLength == 0.0 ) return false;
+
+        // Every corner must turn in the direction of the normal... that alone would also accept self intersecting rings
+        // that wind multiple times around the center (e.g. a pentagram). Hence the number of sign changes of the edge
+        // directions is counted in the plane orthogonal to the dominant normal axis, which must not exceed two per axis.
+        // (Schorn, P., Fisher, F. 1994. Testing the convexity of a polygon. In Graphics Gems IV, pp. 7-15.)
+        int u = 0;
+        int v = 1;
+        if ( fabs( normal.x ) >= fabs( normal.y ) && fabs( normal.x ) >= fabs( normal.z ) ) {
+            u = 1;
+            v = 2;
+        } else if ( fabs( normal.y ) >= fabs( normal.z ) ) {
+            u = 2;
+            v = 0;
+        }
+
+        int lastSign[2] = { 0, 0 };
+        int signChanges[2] = { 0, 0 };
+
+        for ( size_t i = 0; i <= len; i++ )
+        {
+            const TVec3d& a = m_vertices[i % len];
+            const TVec3d& b = m_vertices[( i + 1 ) % len];
+            const TVec3d edge = b - a;
+
+            if ( i < len ) {
+                const TVec3d nextEdge = m_vertices[( i + 2 ) % len] - b;
+                const double turn = edge.cross( nextEdge ).dot( normal );
+
+                // negated comparison so that NaNs are rejected as well
+                if ( !( turn > 1e-10 * edge.length() * nextEdge.length() * normalLength ) ) {
+                    return false;
+                }
+            }
+
+            const double direction[2] = { edge[u], edge[v] };
+            for ( int axis = 0; axis < 2; axis++ ) {
+                const int sign = direction[axis] > 0.0 ? 1 : ( direction[axis] < 0.0 ? -1 : 0 );
+                if ( sign != 0 ) {
+                    if ( lastSign[axis] != 0 && sign != lastSign[axis] ) {
+                        signChanges[axis]++;
+                    }
+                    lastSign[axis] = sign;
+                }
+            }
+        }
+
+        return signChanges[0] <= 2 && signChanges[1] <= 2;
+    }
+
     std::vector<TVec3d>& LinearRing::getVertices()
     {
         return m_vertices;
@@ -80,7 +138,7 @@ namespace citygml {
                     coordinatesList.push_back(texCoords);
 
                     if (m_vertices.size() != texCoords->getCoords().size()) {
-                        CITYGML_LOG_WARN(logger, "Number of vertices in LinearRing with id '" << this->getId() << "' (" <<
+                        CITYGML_LOG_WARN_TYPE(logger, CityGMLLogger::WARNINGTYPE::WT_TEXTURE_COORDINATES_MISMATCH, "Number of vertices in LinearRing with id '" << this->getId() << "' (" <<
                                          m_vertices.size() << ") does not match with number of texture coordinates in coordinates list "
                                          << " with id '" << texCoords->getId() << "' (" << texCoords->getCoords().size() << ")");
                         textureCoordinatesVerticesMismatch = true;
@@ -4,7 +4,7 @@
 
 #include <stdexcept>
 
-citygml::LineString::LineString(const std::string& id) : Object(id)
+citygml::LineString::LineString(const ObjectID& id) : Object(id)
 {
     m_dimensions = -1;
 }
@@ -0,0 +1,34 @@
+#include <citygml/loadstatistics.h>
+
+namespace citygml {
+
+    LoadStatistics::LoadStatistics()
+    {
+        reset();
+    }
+
+    void LoadStatistics::reset()
+    {
+        parsing = PhaseTime();
+        resolving = PhaseTime();
+        finishing = PhaseTime();
+        transformation = PhaseTime();
+
+        bytesRead = 0;
+
+        elements = 0;
+        unknownElements = 0;
+        elementsByName.clear();
+
+        cityObjects = 0;
+        cityObjectsByType.clear();
+
+        polygons = 0;
+        vertices = 0;
+        triangles = 0;
+
+        resolvedXLinks = 0;
+        unresolvedXLinks = 0;
+    }
+
+}
@@ -2,7 +2,7 @@
 
 namespace citygml {
 
-    Material::Material(const std::string& id) : Appearance( id, "Material" )
+    Material::Material(const ObjectID& id) : Appearance( id, "Material" )
     {
         // Sets default values of the X3DMaterial definied in the citygml 1.0.0 spec see page 32 (section 9.3 Material)
         m_ambientIntensity =  0.2f;
@@ -2,7 +2,7 @@
 
 namespace citygml {
 
-    MaterialTargetDefinition::MaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const std::string& id) : AppearanceTargetDefinition(targetID, appearance, id)
+    MaterialTargetDefinition::MaterialTargetDefinition(const std::string& targetID, std::shared_ptr<Material> appearance, const ObjectID& id) : AppearanceTargetDefinition(targetID, appearance, id)
     {
 
     }
@@ -1,25 +1,101 @@
 #include <citygml/object.h>
+#include <citygml/objectarena.h>
 
 #include <sstream>
 #include <iostream>
+#include <mutex>
 
 namespace citygml {
 
-    Object::Object(const std::string& id) : m_id( id )
+    namespace {
+        // Guards the creation of lazy ids, as objects may be accessed by several threads (e.g. while tesselating)
+        std::mutex& getLazyIdMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+    }
+
+    Object::Object(const ObjectID& id) : m_id( id.getString() ), m_generatedId( id.getGeneratedID() )
+        , m_lazyId( m_generatedId != 0 || m_id.empty() )
+    {
+
+    }
+
+    Object::Object(const Object& other) : m_id( other.getId() ), m_generatedId( other.m_generatedId ), m_lazyId( false )
+        , m_attributes( other.m_attributes )
+    {
+
+    }
+
+    Object& Object::operator=(const Object& other)
     {
-        if ( m_id == "" )
+        if ( this != &other )
         {
-         std::stringstream ss;
-         ss << "PtrId_" << this;
-         m_id = ss.str();
+            m_id = other.getId();
+            m_generatedId = other.m_generatedId;
+            m_lazyId.store(false, std::memory_order_release);
+            m_attributes = other.m_attributes;
         }
+        return *this;
     }
 
     const std::string&Object::getId() const
     {
+        // The mutex is only taken until the id string was created
+        if ( !m_lazyId.load(std::memory_order_acquire) )
+        {
+            return m_id;
+        }
+
+        std::lock_guard<std::mutex> lock(getLazyIdMutex());
+        if ( m_lazyId.load(std::memory_order_relaxed) )
+        {
+            if ( m_generatedId != 0 )
+            {
+                m_id = ObjectID::generatedIDToString(m_generatedId);
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "PtrId_" << this;
+                m_id = ss.str();
+            }
+            m_lazyId.store(false, std::memory_order_release);
+        }
         return m_id;
     }
 
+    void* Object::operator new(size_t size)
+    {
+        return ObjectArena::allocateObject(size, nullptr);
+    }
+
+    void* Object::operator new(size_t size, ObjectArena* arena)
+    {
+        return ObjectArena::allocateObject(size, arena);
+    }
+
+    void Object::operator delete(void* ptr)
+    {
+        ObjectArena::deallocateObject(ptr);
+    }
+
+    void Object::operator delete(void* ptr, ObjectArena*)
+    {
+        ObjectArena::deallocateObject(ptr);
+    }
+
+    bool Object::hasGeneratedId() const
+    {
+        return m_generatedId != 0;
+    }
+
+    uint64_t Object::getGeneratedId() const
+    {
+        return m_generatedId;
+    }
+
     std::string Object::getAttribute(const std::string& name) const
     {
         AttributesMap::const_iterator elt = m_attributes.find( name );
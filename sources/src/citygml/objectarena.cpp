@@ -0,0 +1,122 @@
+#include <citygml/objectarena.h>
+
+#include <new>
+
+namespace citygml {
+
+    namespace {
+        // The header in front of every Object, its size keeps the objects aligned for any type
+        union ObjectHeader {
+            ObjectArena* arena;
+            std::max_align_t alignment;
+        };
+
+        const size_t Alignment = sizeof(ObjectHeader);
+
+        size_t alignSize(size_t size)
+        {
+            return (size + Alignment - 1) / Alignment * Alignment;
+        }
+
+        ObjectHeader* getHeader(const void* object)
+        {
+            return reinterpret_cast<ObjectHeader*>(const_cast<char*>(static_cast<const char*>(object)) - sizeof(ObjectHeader));
+        }
+    }
+
+    ObjectArena::ObjectArena(size_t blockSize)
+        : m_references(1)
+        , m_blockSize(alignSize(blockSize))
+        , m_current(nullptr)
+        , m_remaining(0)
+        , m_allocatedBytes(0)
+    {
+
+    }
+
+    ObjectArena* ObjectArena::create(size_t blockSize)
+    {
+        return new ObjectArena(blockSize);
+    }
+
+    void ObjectArena::addReference()
+    {
+        m_references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ObjectArena::releaseReference()
+    {
+        if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    void* ObjectArena::allocate(size_t size)
+    {
+        size = alignSize(size);
+        m_allocatedBytes += size;
+
+        if (size > m_remaining) {
+            // Large allocations get a block of their own so that the rest of the current block is not wasted
+            if (size > m_blockSize / 4) {
+                char* block = static_cast<char*>(::operator new(size));
+                m_blocks.push_back(block);
+                return block;
+            }
+
+            m_current = static_cast<char*>(::operator new(m_blockSize));
+            m_remaining = m_blockSize;
+            m_blocks.push_back(m_current);
+        }
+
+        void* ptr = m_current;
+        m_current += size;
+        m_remaining -= size;
+        return ptr;
+    }
+
+    size_t ObjectArena::getAllocatedBytes() const
+    {
+        return m_allocatedBytes;
+    }
+
+    void* ObjectArena::allocateObject(size_t size, ObjectArena* arena)
+    {
+        ObjectHeader* header;
+        if (arena != nullptr) {
+            header = static_cast<ObjectHeader*>(arena->allocate(sizeof(ObjectHeader) + size));
+            arena->addReference();
+        } else {
+            header = static_cast<ObjectHeader*>(::operator new(sizeof(ObjectHeader) + size));
+        }
+        header->arena = arena;
+        return header + 1;
+    }
+
+    void ObjectArena::deallocateObject(void* object)
+    {
+        if (object == nullptr) {
+            return;
+        }
+
+        ObjectHeader* header = getHeader(object);
+        if (header->arena != nullptr) {
+            header->arena->releaseReference();
+        } else {
+            ::operator delete(header);
+        }
+    }
+
+    ObjectArena* ObjectArena::getArena(const void* object)
+    {
+        return getHeader(object)->arena;
+    }
+
+    ObjectArena::~ObjectArena()
+    {
+        for (char* block : m_blocks) {
+            ::operator delete(block);
+        }
+    }
+
+}
@@ -0,0 +1,63 @@
+#include <citygml/objectid.h>
+
+namespace citygml {
+
+    namespace {
+        // The lower bits of a generated id contain the ordinal, the upper bits the document index
+        const unsigned int ORDINAL_BITS = 40;
+        const uint64_t ORDINAL_MASK = (uint64_t(1) << ORDINAL_BITS) - 1;
+    }
+
+    ObjectID::ObjectID()
+        : m_generatedID(0)
+    {
+
+    }
+
+    ObjectID::ObjectID(std::string id)
+        : m_id(std::move(id))
+        , m_generatedID(0)
+    {
+
+    }
+
+    ObjectID::ObjectID(const char* id)
+        : m_id(id)
+        , m_generatedID(0)
+    {
+
+    }
+
+    ObjectID ObjectID::generate(uint32_t document, uint64_t ordinal)
+    {
+        ObjectID id;
+        id.m_generatedID = (static_cast<uint64_t>(document) << ORDINAL_BITS) | (ordinal & ORDINAL_MASK);
+        return id;
+    }
+
+    bool ObjectID::isGenerated() const
+    {
+        return m_generatedID != 0;
+    }
+
+    uint64_t ObjectID::getGeneratedID() const
+    {
+        return m_generatedID;
+    }
+
+    const std::string& ObjectID::getString() const
+    {
+        return m_id;
+    }
+
+    std::string ObjectID::toString() const
+    {
+        return isGenerated() ? generatedIDToString(m_generatedID) : m_id;
+    }
+
+    std::string ObjectID::generatedIDToString(uint64_t generatedID)
+    {
+        return "genID_" + std::to_string(generatedID >> ORDINAL_BITS) + "_" + std::to_string(generatedID & ORDINAL_MASK);
+    }
+
+}
@@ -2,10 +2,12 @@
 #include <citygml/appearance.h>
 #include <citygml/texture.h>
 #include <citygml/texturecoordinates.h>
-#include <citygml/tesselator.h>
+#include <citygml/tesselatorbase.h>
 #include <citygml/citygmllogger.h>
 #include <citygml/texturetargetdefinition.h>
 #include <citygml/materialtargetdefinition.h>
+#include <citygml/objectarena.h>
+#include <citygml/vertexpool.h>
 
 #include <algorithm>
 #include <stdexcept>
@@ -16,7 +18,9 @@
 
 namespace citygml {
 
-    Polygon::Polygon(const std::string& id, std::shared_ptr<CityGMLLogger> logger)  : AppearanceTarget( id ), m_negNormal( false )
+    Polygon::Polygon(const ObjectID& id, std::shared_ptr<CityGMLLogger> logger)  : AppearanceTarget( id )
+      , m_poolVertexOffset( 0 ), m_poolVertexCount( 0 ), m_poolIndexOffset( 0 ), m_poolIndexCount( 0 ), m_poolOriginIndex( 0 )
+      , m_poolShortIndices( false ), m_negNormal( false )
     {
         m_logger = logger;
         m_finished = false;
@@ -24,19 +28,217 @@ namespace citygml {
 
     const std::vector<TVec3d>& Polygon::getVertices() const
     {
+        if (m_vertexPool != nullptr) {
+            CITYGML_LOG_ERROR(m_logger, "Polygon with id '" << getId() << "' was moved to a VertexPool, getVertices returns an empty list. "
+                              << "Use getVertexCount and getVertex instead.");
+        }
         return m_vertices;
     }
 
     std::vector<TVec3d>& Polygon::getVertices()
     {
+        if (m_vertexPool != nullptr) {
+            CITYGML_LOG_ERROR(m_logger, "Polygon with id '" << getId() << "' was moved to a VertexPool, getVertices returns an empty list. "
+                              << "Use getVertexCount and getVertex instead.");
+        }
         return m_vertices;
     }
 
     const std::vector<unsigned int>& Polygon::getIndices() const
     {
+        if (m_vertexPool != nullptr) {
+            CITYGML_LOG_ERROR(m_logger, "Polygon with id '" << getId() << "' was moved to a VertexPool, getIndices returns an empty list. "
+                              << "Use getIndexCount and getIndex instead.");
+        }
         return m_indices;
     }
 
+    Span<const TVec3d> Polygon::getVertexSpan() const
+    {
+        if (m_vertexPool != nullptr) {
+            if (m_vertexPool->isCompact()) {
+                CITYGML_LOG_ERROR(m_logger, "Polygon with id '" << getId() << "' is stored in a compact VertexPool, getVertexSpan returns an empty span. "
+                                  << "Use getVertex or getLocalVertexSpan instead.");
+                return Span<const TVec3d>();
+            }
+            return Span<const TVec3d>(m_vertexPool->getPositions().data() + m_poolVertexOffset, m_poolVertexCount);
+        }
+        return Span<const TVec3d>(m_vertices.data(), m_vertices.size());
+    }
+
+    Span<const unsigned int> Polygon::getIndexSpan() const
+    {
+        if (m_vertexPool != nullptr) {
+            if (m_poolShortIndices) {
+                CITYGML_LOG_ERROR(m_logger, "Polygon with id '" << getId() << "' uses 16 bit indices, getIndexSpan returns an empty span. "
+                                  << "Use getIndex or getShortIndexSpan instead.");
+                return Span<const unsigned int>();
+            }
+            return Span<const unsigned int>(m_vertexPool->getIndices().data() + m_poolIndexOffset, m_poolIndexCount);
+        }
+        return Span<const unsigned int>(m_indices.data(), m_indices.size());
+    }
+
+    Span<const TVec3f> Polygon::getLocalVertexSpan() const
+    {
+        if (m_vertexPool == nullptr || !m_vertexPool->isCompact()) {
+            return Span<const TVec3f>();
+        }
+        return Span<const TVec3f>(m_vertexPool->getLocalPositions().data() + m_poolVertexOffset, m_poolVertexCount);
+    }
+
+    TVec3d Polygon::getVertexOrigin() const
+    {
+        if (m_vertexPool == nullptr || !m_vertexPool->isCompact()) {
+            return TVec3d(0.0, 0.0, 0.0);
+        }
+        return m_vertexPool->getOrigin(m_poolOriginIndex);
+    }
+
+    Span<const uint16_t> Polygon::getShortIndexSpan() const
+    {
+        if (!m_poolShortIndices) {
+            return Span<const uint16_t>();
+        }
+        return Span<const uint16_t>(m_vertexPool->getShortIndices().data() + m_poolIndexOffset, m_poolIndexCount);
+    }
+
+    size_t Polygon::getVertexCount() const
+    {
+        return m_vertexPool != nullptr ? m_poolVertexCount : m_vertices.size();
+    }
+
+    TVec3d Polygon::getVertex(size_t i) const
+    {
+        if (m_vertexPool == nullptr) {
+            return m_vertices[i];
+        }
+        if (!m_vertexPool->isCompact()) {
+            return m_vertexPool->getPositions()[m_poolVertexOffset + i];
+        }
+
+        const TVec3f& local = m_vertexPool->getLocalPositions()[m_poolVertexOffset + i];
+        const TVec3d& origin = m_vertexPool->getOrigin(m_poolOriginIndex);
+        return TVec3d(origin.x + local.x, origin.y + local.y, origin.z + local.z);
+    }
+
+    size_t Polygon::getIndexCount() const
+    {
+        return m_vertexPool != nullptr ? m_poolIndexCount : m_indices.size();
+    }
+
+    unsigned int Polygon::getIndex(size_t i) const
+    {
+        if (m_vertexPool == nullptr) {
+            return m_indices[i];
+        }
+        if (m_poolShortIndices) {
+            return m_vertexPool->getShortIndices()[m_poolIndexOffset + i];
+        }
+        return m_vertexPool->getIndices()[m_poolIndexOffset + i];
+    }
+
+    Span<const TVec2f> Polygon::getTexCoordSpanForTheme(const std::string& theme, bool front) const
+    {
+        if (m_vertexPool != nullptr) {
+            size_t themeIndex;
+            if (!m_vertexPool->findTheme(theme, themeIndex)) {
+                return Span<const TVec2f>();
+            }
+
+            for (const PoolTexCoords& texCoords : m_poolTexCoords) {
+                if (texCoords.themeIndex == themeIndex && texCoords.front == front) {
+                    return Span<const TVec2f>(m_vertexPool->getTexCoords(themeIndex, front).data() + texCoords.offset, texCoords.count);
+                }
+            }
+            return Span<const TVec2f>();
+        }
+
+        auto& map = front ? m_themeToFrontTexCoordsMap : m_themeToBackTexCoordsMap;
+        auto it = map.find(theme);
+        if (it == map.end()) {
+            return Span<const TVec2f>();
+        }
+        return Span<const TVec2f>(it->second.data(), it->second.size());
+    }
+
+    void Polygon::moveToVertexPool(const std::shared_ptr<VertexPool>& pool, size_t originIndex)
+    {
+        if (m_vertexPool != nullptr) {
+            return;
+        }
+
+        m_poolVertexCount = m_vertices.size();
+        m_poolIndexCount = m_indices.size();
+
+        if (pool->isCompact()) {
+            const TVec3d& origin = pool->getOrigin(originIndex);
+            m_poolOriginIndex = originIndex;
+
+            std::vector<TVec3f>& localPositions = pool->getLocalPositions();
+            m_poolVertexOffset = localPositions.size();
+            for (const TVec3d& vertex : m_vertices) {
+                localPositions.push_back(TVec3f(static_cast<float>(vertex.x - origin.x), static_cast<float>(vertex.y - origin.y), static_cast<float>(vertex.z - origin.z)));
+            }
+
+            m_poolShortIndices = m_vertices.size() <= 0xFFFF;
+        } else {
+            std::vector<TVec3d>& positions = pool->getPositions();
+            m_poolVertexOffset = positions.size();
+            positions.insert(positions.end(), m_vertices.begin(), m_vertices.end());
+        }
+
+        if (m_poolShortIndices) {
+            std::vector<uint16_t>& shortIndices = pool->getShortIndices();
+            m_poolIndexOffset = shortIndices.size();
+            for (unsigned int index : m_indices) {
+                shortIndices.push_back(static_cast<uint16_t>(index));
+            }
+        } else {
+            std::vector<unsigned int>& indices = pool->getIndices();
+            m_poolIndexOffset = indices.size();
+            indices.insert(indices.end(), m_indices.begin(), m_indices.end());
+        }
+
+        for (bool front : { true, false }) {
+            for (const auto& themeTexCoords : front ? m_themeToFrontTexCoordsMap : m_themeToBackTexCoordsMap) {
+                PoolTexCoords texCoords;
+                texCoords.themeIndex = pool->addTheme(themeTexCoords.first);
+                texCoords.front = front;
+
+                std::vector<TVec2f>& poolTexCoords = pool->getTexCoords(texCoords.themeIndex, front);
+                texCoords.offset = poolTexCoords.size();
+                texCoords.count = themeTexCoords.second.size();
+                poolTexCoords.insert(poolTexCoords.end(), themeTexCoords.second.begin(), themeTexCoords.second.end());
+
+                m_poolTexCoords.push_back(texCoords);
+            }
+        }
+
+        // Swapping with empty containers releases the memory (clear keeps it)
+        std::vector<TVec3d>().swap(m_vertices);
+        std::vector<unsigned int>().swap(m_indices);
+        std::unordered_map<std::string, std::vector<TVec2f> >().swap(m_themeToFrontTexCoordsMap);
+        std::unordered_map<std::string, std::vector<TVec2f> >().swap(m_themeToBackTexCoordsMap);
+
+        m_vertexPool = pool;
+    }
+
+    std::shared_ptr<const VertexPool> Polygon::getVertexPool() const
+    {
+        return m_vertexPool;
+    }
+
+    size_t Polygon::getVertexPoolOffset() const
+    {
+        return m_poolVertexOffset;
+    }
+
+    size_t Polygon::getIndexPoolOffset() const
+    {
+        return m_poolIndexOffset;
+    }
+
 
     std::shared_ptr<const Material> Polygon::getMaterialFor(const std::string& theme, bool front) const
     {
@@ -76,6 +278,10 @@ namespace citygml {
 
     const std::vector<TVec2f> Polygon::getTexCoordsForTheme(const std::string& theme, bool front) const
     {
+        if (m_vertexPool != nullptr) {
+            return getTexCoordSpanForTheme(theme, front).toVector();
+        }
+
         auto& map = front ? m_themeToFrontTexCoordsMap : m_themeToBackTexCoordsMap;
         auto it = map.find(theme);
 
@@ -144,7 +350,8 @@ namespace citygml {
 
         const auto targetDef = getTextureTargetDefinitionForTheme(theme, front);
 
-        if (targetDef == nullptr) {
+        // Rings without gml:id can not be referenced by texture coordinates
+        if (targetDef == nullptr || ring.hasGeneratedId()) {
             return std::vector<TVec2f>();
         }
 
@@ -171,10 +378,8 @@ namespace citygml {
         return texCoordsLists;
     }
 
-    void Polygon::createIndicesWithTesselation(Tesselator& tesselator, std::shared_ptr<CityGMLLogger> logger)
+    void Polygon::createIndicesWithTesselation(TesselatorBase& tesselator, const TVec3d& normal, std::shared_ptr<CityGMLLogger> logger)
     {
-        TVec3d normal = computeNormal();
-
         std::vector<std::string> themesFront = getAllTextureThemes(true);
         std::vector<std::string> themesBack = getAllTextureThemes(false);
 
@@ -199,47 +404,92 @@ namespace citygml {
         }
 
         tesselator.compute();
-        m_vertices = tesselator.getVertices();
-        m_indices = tesselator.getIndices();
+        m_vertices = tesselator.takeVertices();
+        m_indices = tesselator.takeIndices();
 
         if (m_vertices.empty()) {
             return;
         }
 
-        const std::vector<std::vector<TVec2f> >& texCoordLists = tesselator.getTexCoords();
+        std::vector<std::vector<TVec2f> > texCoordLists = tesselator.takeTexCoords();
 
         for (size_t i = 0; i < themesFront.size(); i++) {
             assert(texCoordLists.at(i).size() == m_vertices.size());
-            m_themeToFrontTexCoordsMap[themesFront.at(i)] = texCoordLists.at(i);
+            m_themeToFrontTexCoordsMap[themesFront.at(i)] = std::move(texCoordLists.at(i));
         }
 
         for (size_t i = 0; i < themesBack.size(); i++) {
             assert(texCoordLists.at(i + themesFront.size()).size() == m_vertices.size());
-            m_themeToBackTexCoordsMap[themesBack.at(i)] = texCoordLists.at(i + themesFront.size());
+            m_themeToBackTexCoordsMap[themesBack.at(i)] = std::move(texCoordLists.at(i + themesFront.size()));
+        }
+    }
+
+    void Polygon::createIndicesForConvexRing(TesselatorBase& tesselator, std::shared_ptr<CityGMLLogger> logger)
+    {
+        // Produces the same vertex and texture coordinates layout as the tesselator (all vertices of the ring in order)
+        for (bool front : { true, false }) {
+            for (const std::string& theme : getAllTextureThemes(front)) {
+                std::vector<TVec2f> texCoords = getTexCoordsForRingAndTheme(*m_exteriorRing, theme, front);
+
+                if (texCoords.size() != m_exteriorRing->size()) {
+                    if (!texCoords.empty()) {
+                        CITYGML_LOG_ERROR(logger, "The number of texture coordinates (" << texCoords.size() << ") of theme " << theme << " for ring with id " << m_exteriorRing->getId()
+                                          << " does not match the number of vertices (" << m_exteriorRing->size() << "). The texture coordinates list will be resized which may cause invalid texture coordinates.");
+                    }
+                    texCoords.resize(m_exteriorRing->size(), TVec2f(0.f, 0.f));
+                }
+
+                (front ? m_themeToFrontTexCoordsMap : m_themeToBackTexCoordsMap)[theme] = std::move(texCoords);
+            }
+        }
+
+        m_vertices = m_exteriorRing->getVertices();
+        if (!tesselator.keepVertices())
+        {
+            m_exteriorRing->forgetVertices();
+        }
+
+        unsigned int len = m_vertices.size();
+        if (len > 1 && m_vertices.front() == m_vertices.back()) {
+            len--; // the closing vertex is not referenced
+        }
+
+        // The tesselator orients the triangles counter clockwise with respect to the polygon normal which is the
+        // negated ring normal if m_negNormal is set
+        m_indices.reserve(3 * (len - 2));
+        for (unsigned int i = 1; i + 1 < len; i++) {
+            m_indices.push_back(0);
+            m_indices.push_back(m_negNormal ? i + 1 : i);
+            m_indices.push_back(m_negNormal ? i : i + 1);
         }
     }
 
-    void Polygon::computeIndices(Tesselator& tesselator, std::shared_ptr<CityGMLLogger> logger )
+    void Polygon::computeIndices(TesselatorBase& tesselator, std::shared_ptr<CityGMLLogger> logger )
     {
         m_indices.clear();
         m_vertices.clear();
 
-        createIndicesWithTesselation(tesselator, logger);
+        TVec3d normal = computeNormal();
+
+        if (tesselator.convexFastPath() && m_exteriorRing != nullptr && m_interiorRings.empty()
+                && m_exteriorRing->isConvex(m_negNormal ? -normal : normal)) {
+            createIndicesForConvexRing(tesselator, logger);
+        } else {
+            createIndicesWithTesselation(tesselator, normal, logger);
+        }
 
         if ( m_vertices.size() < 3 ) {
-            CITYGML_LOG_WARN(logger, "Polygon with id " << this->getId() << " has less than 3 vertices.");
+            CITYGML_LOG_WARN_TYPE(logger, CityGMLLogger::WARNINGTYPE::WT_POLYGON_TOO_FEW_VERTICES, "Polygon with id " << this->getId() << " has less than 3 vertices.");
         }
     }
 
-    void Polygon::finish(Tesselator& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
+    void Polygon::finish(TesselatorBase& tesselator, bool optimize, std::shared_ptr<CityGMLLogger> logger)
     {
-        if (m_finished) {
+        if (m_finished.exchange(true)) {
             // This may happen as Polygons can be shared between geometries
             return;
         }
 
-        m_finished = true;
-
         if (optimize) {
             removeDuplicateVerticesInRings(logger);
         }
@@ -248,6 +498,65 @@ namespace citygml {
 
     }
 
+    std::shared_ptr<Polygon> Polygon::merge(const std::vector<std::shared_ptr<const Polygon> >& polygons, std::shared_ptr<CityGMLLogger> logger)
+    {
+        const Polygon& first = *polygons.front();
+
+        // The merged polygon is allocated on the heap as object arenas are filled by their factory only. It gets a generated id as the
+        // first polygon may be merged in several LODs and remains in the geometries that are not merged (e.g. implicit geometries)
+        std::shared_ptr<Polygon> merged(new Polygon(ObjectID(), logger));
+        merged->addTargetDefinitionsOf(first);
+        merged->m_negNormal = first.m_negNormal;
+        merged->m_finished = true;
+
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        for (const std::shared_ptr<const Polygon>& polygon : polygons) {
+            vertexCount += polygon->getVertexCount();
+            indexCount += polygon->getIndexCount();
+        }
+        merged->m_vertices.reserve(vertexCount);
+        merged->m_indices.reserve(indexCount);
+
+        // All polygons have the same textures, hence the same texture themes
+        for (bool front : { true, false }) {
+            auto& map = front ? merged->m_themeToFrontTexCoordsMap : merged->m_themeToBackTexCoordsMap;
+            for (const std::string& theme : first.getAllTextureThemes(front)) {
+                map[theme].reserve(vertexCount);
+            }
+        }
+
+        for (const std::shared_ptr<const Polygon>& polygon : polygons) {
+            const size_t vertexOffset = merged->m_vertices.size();
+            const size_t count = polygon->getVertexCount();
+
+            for (size_t i = 0; i < count; i++) {
+                merged->m_vertices.push_back(polygon->getVertex(i));
+            }
+
+            for (size_t i = 0; i < polygon->getIndexCount(); i++) {
+                merged->m_indices.push_back(static_cast<unsigned int>(vertexOffset + polygon->getIndex(i)));
+            }
+
+            for (bool front : { true, false }) {
+                auto& map = front ? merged->m_themeToFrontTexCoordsMap : merged->m_themeToBackTexCoordsMap;
+                for (const std::string& theme : first.getAllTextureThemes(front)) {
+                    std::vector<TVec2f>& texCoords = map[theme];
+                    const Span<const TVec2f> polygonTexCoords = polygon->getTexCoordSpanForTheme(theme, front);
+                    if (polygonTexCoords.size() != count) {
+                        CITYGML_LOG_WARN(logger, "Polygon with id " << polygon->getId() << " has " << polygonTexCoords.size() << " texture coordinates for theme "
+                                         << theme << " but " << count << " vertices. The texture coordinates of the merged polygon will be resized.");
+                    }
+                    for (size_t i = 0; i < count; i++) {
+                        texCoords.push_back(i < polygonTexCoords.size() ? polygonTexCoords[i] : TVec2f(0.f, 0.f));
+                    }
+                }
+            }
+        }
+
+        return merged;
+    }
+
     void Polygon::addRing( LinearRing* ring )
     {
         if (m_finished) {
@@ -262,10 +571,10 @@ namespace citygml {
         }
 
         if ( ring->isExterior() ) {
-            m_exteriorRing = std::shared_ptr<LinearRing>(ring);
+            m_exteriorRing = ObjectArena::share(ring);
         }
         else {
-            m_interiorRings.push_back( std::shared_ptr<LinearRing>(ring) );
+            m_interiorRings.push_back( ObjectArena::share(ring) );
         }
     }
 
@@ -9,20 +9,90 @@ namespace citygml {
     PolygonManager::PolygonManager(std::shared_ptr<CityGMLLogger> logger)
     {
         m_logger = logger;
+        m_firstRecentRequest = 0;
+        m_resolvedRequests = 0;
+        m_unresolvedRequests = 0;
     }
 
     void PolygonManager::addPolygon(std::shared_ptr<Polygon> poly)
     {
+        if (poly->hasGeneratedId()) {
+            // Polygons without gml:id can not be referenced
+            return;
+        }
+
         if (m_sharedPolygons.count(poly->getId()) > 0) {
-            CITYGML_LOG_WARN(m_logger, "Duplicate definition of Polygon with id '" << poly->getId() << "'... overwriting existing object.");
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_DUPLICATE_ID, "Duplicate definition of Polygon with id '" << poly->getId() << "'... overwriting existing object.");
         }
 
         m_sharedPolygons[poly->getId()] = poly;
     }
 
-    void PolygonManager::requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonID)
+    void PolygonManager::requestSharedPolygonForGeometry(Geometry* geom, const std::string& polygonID, const DocumentPosition& position)
     {
-        m_polygonRequests.push_back(PolygonRequest(geom, polygonID));
+        m_polygonRequests.push_back(PolygonRequest(geom, polygonID, position));
+    }
+
+    bool PolygonManager::finishRecentRequests(const std::vector<Polygon*>& polygons)
+    {
+        std::unordered_set<const Polygon*> polygonSet(polygons.begin(), polygons.end());
+
+        bool resolvable = true;
+        for (size_t i = m_firstRecentRequest; i < m_polygonRequests.size() && resolvable; i++) {
+            auto it = m_sharedPolygons.find(m_polygonRequests[i].polygonID);
+            resolvable = it != m_sharedPolygons.end() && polygonSet.count(it->second.get()) > 0;
+        }
+
+        for (size_t i = 0; i < polygons.size() && resolvable && !m_deferredPolygonIDs.empty(); i++) {
+            resolvable = polygons[i]->hasGeneratedId() || m_deferredPolygonIDs.count(polygons[i]->getId()) == 0;
+        }
+
+        if (!resolvable) {
+            for (size_t i = m_firstRecentRequest; i < m_polygonRequests.size(); i++) {
+                m_deferredPolygonIDs.insert(m_polygonRequests[i].polygonID);
+            }
+            m_firstRecentRequest = m_polygonRequests.size();
+            return false;
+        }
+
+        for (size_t i = m_firstRecentRequest; i < m_polygonRequests.size(); i++) {
+            m_polygonRequests[i].target->addPolygon(m_sharedPolygons[m_polygonRequests[i].polygonID]);
+        }
+        m_resolvedRequests += m_polygonRequests.size() - m_firstRecentRequest;
+        m_polygonRequests.erase(m_polygonRequests.begin() + m_firstRecentRequest, m_polygonRequests.end());
+
+        for (Polygon* polygon : polygons) {
+            if (polygon->hasGeneratedId()) {
+                continue;
+            }
+            auto it = m_sharedPolygons.find(polygon->getId());
+            if (it != m_sharedPolygons.end() && it->second.get() == polygon) {
+                m_sharedPolygons.erase(it);
+            }
+        }
+
+        return true;
+    }
+
+    void PolygonManager::merge(PolygonManager& other)
+    {
+        for (auto& entry : other.m_sharedPolygons) {
+            addPolygon(entry.second);
+        }
+
+        m_polygonRequests.insert(m_polygonRequests.end(), other.m_polygonRequests.begin(), other.m_polygonRequests.end());
+        m_deferredPolygonIDs.insert(other.m_deferredPolygonIDs.begin(), other.m_deferredPolygonIDs.end());
+        m_firstRecentRequest = m_polygonRequests.size();
+
+        other.m_sharedPolygons.clear();
+        other.m_polygonRequests.clear();
+        other.m_deferredPolygonIDs.clear();
+        other.m_firstRecentRequest = 0;
+
+        m_resolvedRequests += other.m_resolvedRequests;
+        m_unresolvedRequests += other.m_unresolvedRequests;
+        other.m_resolvedRequests = 0;
+        other.m_unresolvedRequests = 0;
     }
 
     void PolygonManager::finish()
@@ -32,21 +102,35 @@ namespace citygml {
 
             auto it = m_sharedPolygons.find(request.polygonID);
             if (it == m_sharedPolygons.end()) {
-                CITYGML_LOG_WARN(m_logger, "Geometry object with id '" << request.target->getId() << "' requests Polygon with id '" << request.polygonID << "' but no such"
-                                 << " Polygon object exists.");
+                CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_UNRESOLVED_POLYGON_XLINK, "Geometry object with id '" << request.target->getId() << "' requests Polygon with id '" << request.polygonID << "' but no such"
+                                 << " Polygon object exists (xlink at" << request.position << ").");
+                m_unresolvedRequests++;
                 continue;
             }
 
             request.target->addPolygon(it->second);
+            m_resolvedRequests++;
 
         }
 
         m_sharedPolygons.clear();
         m_polygonRequests.clear();
+        m_firstRecentRequest = 0;
+        m_deferredPolygonIDs.clear();
 
         CITYGML_LOG_INFO(m_logger, "Finished processing polygon requests.");
     }
 
+    size_t PolygonManager::getResolvedRequestsCount() const
+    {
+        return m_resolvedRequests;
+    }
+
+    size_t PolygonManager::getUnresolvedRequestsCount() const
+    {
+        return m_unresolvedRequests;
+    }
+
     PolygonManager::~PolygonManager()
     {
 
@@ -34,11 +34,23 @@
 #include <assert.h>
 #include <algorithm>
 
+// The GLU tesselator copies the coordinates passed to gluTessVertex but keeps the vertex data pointer until
+// gluTessEndPolygon. Instead of pointing into a (node based, address stable) index storage the vertex index itself is
+// passed as the data pointer. The index is offset by one as GLU passes null pointers for unused combine vertices.
+static inline void* indexToVertexData(size_t index)
+{
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(index + 1));
+}
+
+static inline unsigned int vertexDataToIndex(void* data)
+{
+    return static_cast<unsigned int>(reinterpret_cast<uintptr_t>(data) - 1);
+}
+
 Tesselator::Tesselator(std::shared_ptr<citygml::CityGMLLogger> logger )
+    : TesselatorBase( logger )
 {
-    _logger = logger;
     _tobj = gluNewTess();
-    _keepVertices = false;
 
     gluTessCallback( _tobj, GLU_TESS_VERTEX_DATA, (GLU_TESS_CALLBACK)&vertexDataCallback );
     gluTessCallback( _tobj, GLU_TESS_BEGIN_DATA, (GLU_TESS_CALLBACK)&beginCallback );
@@ -47,18 +59,21 @@ Tesselator::Tesselator(std::shared_ptr<citygml::CityGMLLogger> logger )
     gluTessCallback( _tobj, GLU_TESS_ERROR_DATA, (GLU_TESS_CALLBACK)&errorCallback );
 }
 
+void Tesselator::init( const TVec3d& normal )
+{
+    init( normal, GLU_TESS_WINDING_ODD );
+}
+
 void Tesselator::init( const TVec3d& normal, GLenum winding_rule )
 {
+    TesselatorBase::init( normal );
+
     gluTessBeginPolygon( _tobj, this );
 
     gluTessProperty( _tobj, GLU_TESS_WINDING_RULE, winding_rule );
     gluTessNormal( _tobj, normal.x, normal.y, normal.z );
 
-    _vertices.clear();
-    _indices.clear();
     _curIndices.clear();
-    _texCoordsLists.clear();
-    _outIndices.clear();
 }
 
 Tesselator::~Tesselator()
@@ -66,85 +81,35 @@ Tesselator::~Tesselator()
     gluDeleteTess( _tobj );
 }
 
-void Tesselator::compute()
-{
-    gluTessEndPolygon( _tobj );
-}
-
-const std::vector<TVec3d> Tesselator::getVertices() const
-{
-    return std::vector<TVec3d>(_vertices.begin(), _vertices.end());
-}
-
-const std::vector<unsigned int>& Tesselator::getIndices() const
-{
-    return _outIndices;
-}
-
-void Tesselator::setKeepVertices(bool value)
+std::unique_ptr<TesselatorBase> Tesselator::clone() const
 {
-    _keepVertices = value;
+    std::unique_ptr<TesselatorBase> tesselator(new Tesselator(_logger));
+    tesselator->setKeepVertices(_keepVertices);
+    tesselator->setConvexFastPath(_convexFastPath);
+    return tesselator;
 }
 
-bool Tesselator::keepVertices() const
+void Tesselator::compute()
 {
-    return _keepVertices;
+    gluTessEndPolygon( _tobj );
 }
 
 void Tesselator::addContour(const std::vector<TVec3d>& pts, std::vector<std::vector<TVec2f> > textureCoordinatesLists )
 {
-    unsigned int len = pts.size();
-    if ( len < 3 ) return;
-
-    for (size_t i = 0; i < textureCoordinatesLists.size(); i++) {
-
-        std::vector<TVec2f>& texCoords = textureCoordinatesLists.at(i);
-
-
-
-        if (texCoords.size() != pts.size()) {
-            if (!texCoords.empty()) {
-                CITYGML_LOG_ERROR(_logger, "Invalid call to 'addContour'. The number of texture coordinates in list " << i << " (" << texCoords.size() << ") "
-                             "does not match the number of vertices (" << pts.size() << "). The texture coordinates list will be resized which may cause invalid texture coordinates.");
-            }
-
-            texCoords.resize(pts.size(), TVec2f(0.f, 0.f));
-        }
-    }
-
-    for (size_t i = 0; i < std::max(_texCoordsLists.size(), textureCoordinatesLists.size()); i++) {
-
-        if (i >= _texCoordsLists.size()) {
-            std::vector<TVec2f> texCoords(_vertices.size(), TVec2f(0.f, 0.f));
-            texCoords.insert(texCoords.end(), textureCoordinatesLists.at(i).begin(), textureCoordinatesLists.at(i).end());
-            _texCoordsLists.push_back(texCoords);
-        } else if (i >= textureCoordinatesLists.size()) {
-            _texCoordsLists.at(i).resize(_texCoordsLists.at(i).size() + pts.size(), TVec2f(0.f, 0.f));
-        } else {
-            _texCoordsLists.at(i).insert(_texCoordsLists.at(i).end(), textureCoordinatesLists.at(i).begin(), textureCoordinatesLists.at(i).end());
-        }
+    unsigned int pos = _vertices.size();
 
-    }
+    TesselatorBase::addContour( pts, std::move(textureCoordinatesLists) );
 
-    unsigned int pos = _vertices.size();
+    if ( _vertices.size() == pos ) return; // the contour was ignored
 
     gluTessBeginContour( _tobj );
 
-    for ( unsigned int i = 0; i < len; i++ )
+    for ( unsigned int i = pos; i < _vertices.size(); i++ )
     {
-        _vertices.push_back( pts[i] );
-        _indices.push_back(pos + i);
-
-        gluTessVertex( _tobj, &(_vertices.back()[0]), &_indices.back() );
+        gluTessVertex( _tobj, &(_vertices[i][0]), indexToVertexData(i) );
     }
 
     gluTessEndContour( _tobj );
-
-#ifndef NDEBUG
-    for (size_t i = 0; i < _texCoordsLists.size(); i++) {
-        assert(_texCoordsLists.at(i).size() == _vertices.size());
-    }
-#endif
 }
 
 void CALLBACK Tesselator::beginCallback( GLenum which, void* userData )
@@ -156,7 +121,7 @@ void CALLBACK Tesselator::beginCallback( GLenum which, void* userData )
 void CALLBACK Tesselator::vertexDataCallback( GLvoid *data, void* userData )
 {
     Tesselator *tess = static_cast<Tesselator*>(userData);
-    unsigned int index = *reinterpret_cast<unsigned int*>(data);
+    unsigned int index = vertexDataToIndex(data);
 
     assert(index < tess->_vertices.size());
 
@@ -166,7 +131,7 @@ void CALLBACK Tesselator::vertexDataCallback( GLvoid *data, void* userData )
 void CALLBACK Tesselator::combineCallback( GLdouble coords[3], void* vertex_data[4], GLfloat weight[4], void** outData, void* userData )
 {
     Tesselator *tess = static_cast<Tesselator*>(userData);
-    tess->_indices.push_back(tess->_indices.size());
+    size_t newIndex = tess->_vertices.size();
     tess->_vertices.push_back( TVec3d( coords[0], coords[1], coords[2] ) );
 
     if (!tess->_texCoordsLists.empty()) {
@@ -181,7 +146,7 @@ void CALLBACK Tesselator::combineCallback( GLdouble coords[3], void* vertex_data
 
             for (int i = 0; i < 4; i++) {
                 if (vertex_data[i] != nullptr) {
-                    unsigned int vertexIndex = *reinterpret_cast<unsigned int*>(vertex_data[i]);
+                    unsigned int vertexIndex = vertexDataToIndex(vertex_data[i]);
                     newTexCoord = newTexCoord + weight[i] * texcords.at(vertexIndex);
                 }
             }
@@ -193,7 +158,7 @@ void CALLBACK Tesselator::combineCallback( GLdouble coords[3], void* vertex_data
         }
     }
 
-    *outData = &tess->_indices.back();
+    *outData = indexToVertexData(newIndex);
 }
 
 void CALLBACK Tesselator::endCallback( void* userData )
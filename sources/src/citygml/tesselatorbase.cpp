@@ -0,0 +1,147 @@
+/* -*-c++-*- libcitygml - Copyright (c) 2010 Joachim Pouderoux, BRGM
+*
+* This file is part of libcitygml library
+* http://code.google.com/p/libcitygml
+*
+* libcitygml is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 2.1 of the License, or
+* (at your option) any later version.
+*
+* libcitygml is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*/
+
+#include <citygml/tesselatorbase.h>
+#include <citygml/citygmllogger.h>
+
+#include <assert.h>
+#include <algorithm>
+
+TesselatorBase::TesselatorBase(std::shared_ptr<citygml::CityGMLLogger> logger)
+{
+    _logger = logger;
+    _keepVertices = false;
+    _convexFastPath = true;
+}
+
+TesselatorBase::~TesselatorBase()
+{
+
+}
+
+void TesselatorBase::init( const TVec3d& normal )
+{
+    _normal = normal;
+
+    _vertices.clear();
+    _texCoordsLists.clear();
+    _outIndices.clear();
+    _contourBegins.clear();
+}
+
+const std::vector<TVec3d>& TesselatorBase::getVertices() const
+{
+    return _vertices;
+}
+
+const std::vector<unsigned int>& TesselatorBase::getIndices() const
+{
+    return _outIndices;
+}
+
+std::vector<TVec3d> TesselatorBase::takeVertices()
+{
+    std::vector<TVec3d> vertices(_vertices.begin(), _vertices.end());
+    _vertices.clear();
+    return vertices;
+}
+
+std::vector<std::vector<TVec2f> > TesselatorBase::takeTexCoords()
+{
+    std::vector<std::vector<TVec2f> > texCoordsLists;
+    texCoordsLists.reserve(_texCoordsLists.size());
+    for (std::vector<TVec2f>& texCoords : _texCoordsLists) {
+        texCoordsLists.push_back(std::vector<TVec2f>(texCoords.begin(), texCoords.end()));
+        texCoords.clear();
+    }
+    return texCoordsLists;
+}
+
+std::vector<unsigned int> TesselatorBase::takeIndices()
+{
+    std::vector<unsigned int> indices(_outIndices.begin(), _outIndices.end());
+    _outIndices.clear();
+    return indices;
+}
+
+void TesselatorBase::setKeepVertices(bool value)
+{
+    _keepVertices = value;
+}
+
+bool TesselatorBase::keepVertices() const
+{
+    return _keepVertices;
+}
+
+void TesselatorBase::setConvexFastPath(bool value)
+{
+    _convexFastPath = value;
+}
+
+bool TesselatorBase::convexFastPath() const
+{
+    return _convexFastPath;
+}
+
+void TesselatorBase::addContour(const std::vector<TVec3d>& pts, std::vector<std::vector<TVec2f> > textureCoordinatesLists )
+{
+    unsigned int len = pts.size();
+    if ( len < 3 ) return;
+
+    for (size_t i = 0; i < textureCoordinatesLists.size(); i++) {
+
+        std::vector<TVec2f>& texCoords = textureCoordinatesLists.at(i);
+
+
+
+        if (texCoords.size() != pts.size()) {
+            if (!texCoords.empty()) {
+                CITYGML_LOG_ERROR(_logger, "Invalid call to 'addContour'. The number of texture coordinates in list " << i << " (" << texCoords.size() << ") "
+                             "does not match the number of vertices (" << pts.size() << "). The texture coordinates list will be resized which may cause invalid texture coordinates.");
+            }
+
+            texCoords.resize(pts.size(), TVec2f(0.f, 0.f));
+        }
+    }
+
+    for (size_t i = 0; i < std::max(_texCoordsLists.size(), textureCoordinatesLists.size()); i++) {
+
+        if (i >= _texCoordsLists.size()) {
+            if (_vertices.empty()) {
+                _texCoordsLists.push_back(std::move(textureCoordinatesLists.at(i)));
+            } else {
+                std::vector<TVec2f> texCoords(_vertices.size(), TVec2f(0.f, 0.f));
+                texCoords.insert(texCoords.end(), textureCoordinatesLists.at(i).begin(), textureCoordinatesLists.at(i).end());
+                _texCoordsLists.push_back(std::move(texCoords));
+            }
+        } else if (i >= textureCoordinatesLists.size()) {
+            _texCoordsLists.at(i).resize(_texCoordsLists.at(i).size() + pts.size(), TVec2f(0.f, 0.f));
+        } else {
+            _texCoordsLists.at(i).insert(_texCoordsLists.at(i).end(), textureCoordinatesLists.at(i).begin(), textureCoordinatesLists.at(i).end());
+        }
+
+    }
+
+    _contourBegins.push_back(_vertices.size());
+    _vertices.insert( _vertices.end(), pts.begin(), pts.end() );
+
+#ifndef NDEBUG
+    for (size_t i = 0; i < _texCoordsLists.size(); i++) {
+        assert(_texCoordsLists.at(i).size() == _vertices.size());
+    }
+#endif
+}
@@ -3,14 +3,14 @@
 
 namespace citygml {
 
-    TextureCoordinates::TextureCoordinates(std::string id, std::string targetID) : Object(id)
+    TextureCoordinates::TextureCoordinates(const ObjectID& id, std::string targetID) : Object(id)
     {
         m_targetID = targetID;
     }
 
     bool TextureCoordinates::targets(const LinearRing& ring) const
     {
-        return m_targetID == ring.getId();
+        return !ring.hasGeneratedId() && m_targetID == ring.getId();
     }
 
     std::string TextureCoordinates::getTargetLinearRingID() const
@@ -3,7 +3,7 @@
 
 namespace citygml {
 
-    TextureTargetDefinition::TextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const std::string& id) : AppearanceTargetDefinition(targetID, appearance, id)
+    TextureTargetDefinition::TextureTargetDefinition(const std::string& targetID, std::shared_ptr<Texture> appearance, const ObjectID& id) : AppearanceTargetDefinition(targetID, appearance, id)
     {
     }
 
@@ -0,0 +1,137 @@
+#include <citygml/tracing.h>
+
+#include <atomic>
+
+namespace citygml {
+
+    namespace {
+        // The sink is read for every event, hence the raw pointer is atomic while the ownership is guarded by the mutex
+        std::mutex traceSinkMutex;
+        std::shared_ptr<TraceSink> traceSinkOwner;
+        std::atomic<TraceSink*> traceSink(nullptr);
+
+        void writeJSONString(std::ostream& stream, const char* begin, const char* end)
+        {
+            stream << '"';
+            for (const char* it = begin; it != end; ++it) {
+                const unsigned char c = static_cast<unsigned char>(*it);
+                if (c == '"' || c == '\\') {
+                    stream << '\\' << *it;
+                } else if (c < 0x20) {
+                    const char* hex = "0123456789abcdef";
+                    stream << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+                } else {
+                    stream << *it;
+                }
+            }
+            stream << '"';
+        }
+    }
+
+    TraceSink::~TraceSink()
+    {
+
+    }
+
+    ChromeTraceSink::ChromeTraceSink(std::ostream& stream)
+        : m_stream(stream)
+        , m_start(std::chrono::steady_clock::now())
+        , m_firstEvent(true)
+    {
+        m_stream << "{\"traceEvents\":[";
+    }
+
+    ChromeTraceSink::ChromeTraceSink(const std::string& fileName)
+        : m_file(fileName)
+        , m_stream(m_file)
+        , m_start(std::chrono::steady_clock::now())
+        , m_firstEvent(true)
+    {
+        m_stream << "{\"traceEvents\":[";
+    }
+
+    void ChromeTraceSink::beginEvent(const char* name, const std::string& detail)
+    {
+        writeEvent(name, 'B', detail);
+    }
+
+    void ChromeTraceSink::endEvent(const char* name)
+    {
+        writeEvent(name, 'E', std::string());
+    }
+
+    void ChromeTraceSink::writeEvent(const char* name, char phase, const std::string& detail)
+    {
+        const long long timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const unsigned int threadID = m_threadIDs.insert(std::make_pair(std::this_thread::get_id(), static_cast<unsigned int>(m_threadIDs.size() + 1))).first->second;
+
+        m_stream << (m_firstEvent ? "\n" : ",\n");
+        m_firstEvent = false;
+
+        m_stream << "{\"name\":";
+        writeJSONString(m_stream, name, name + std::char_traits<char>::length(name));
+        m_stream << ",\"cat\":\"citygml\",\"ph\":\"" << phase << "\",\"ts\":" << timestamp << ",\"pid\":1,\"tid\":" << threadID;
+        if (!detail.empty()) {
+            m_stream << ",\"args\":{\"detail\":";
+            writeJSONString(m_stream, detail.data(), detail.data() + detail.size());
+            m_stream << "}";
+        }
+        m_stream << "}";
+    }
+
+    ChromeTraceSink::~ChromeTraceSink()
+    {
+        m_stream << "\n]}\n";
+        m_stream.flush();
+    }
+
+    void setTraceSink(std::shared_ptr<TraceSink> sink)
+    {
+        std::lock_guard<std::mutex> lock(traceSinkMutex);
+        traceSinkOwner = sink;
+        traceSink.store(sink.get());
+    }
+
+    std::shared_ptr<TraceSink> getTraceSink()
+    {
+        std::lock_guard<std::mutex> lock(traceSinkMutex);
+        return traceSinkOwner;
+    }
+
+    void traceBegin(const char* name, const std::string& detail)
+    {
+        TraceSink* sink = traceSink.load(std::memory_order_relaxed);
+        if (sink != nullptr) {
+            sink->beginEvent(name, detail);
+        }
+    }
+
+    void traceEnd(const char* name)
+    {
+        TraceSink* sink = traceSink.load(std::memory_order_relaxed);
+        if (sink != nullptr) {
+            sink->endEvent(name);
+        }
+    }
+
+    ScopedTraceEvent::ScopedTraceEvent(const char* name)
+        : m_name(name)
+    {
+        traceBegin(m_name);
+    }
+
+    ScopedTraceEvent::ScopedTraceEvent(const char* name, const std::string& detail)
+        : m_name(name)
+    {
+        traceBegin(m_name, detail);
+    }
+
+    ScopedTraceEvent::~ScopedTraceEvent()
+    {
+        traceEnd(m_name);
+    }
+
+}
@@ -0,0 +1,118 @@
+#include <citygml/vertexpool.h>
+
+#include <algorithm>
+
+namespace citygml {
+
+    VertexPool::VertexPool(bool compact)
+        : m_compact(compact)
+    {
+
+    }
+
+    bool VertexPool::isCompact() const
+    {
+        return m_compact;
+    }
+
+    std::vector<TVec3d>& VertexPool::getPositions()
+    {
+        return m_positions;
+    }
+
+    const std::vector<TVec3d>& VertexPool::getPositions() const
+    {
+        return m_positions;
+    }
+
+    std::vector<unsigned int>& VertexPool::getIndices()
+    {
+        return m_indices;
+    }
+
+    const std::vector<unsigned int>& VertexPool::getIndices() const
+    {
+        return m_indices;
+    }
+
+    std::vector<TVec3f>& VertexPool::getLocalPositions()
+    {
+        return m_localPositions;
+    }
+
+    const std::vector<TVec3f>& VertexPool::getLocalPositions() const
+    {
+        return m_localPositions;
+    }
+
+    std::vector<uint16_t>& VertexPool::getShortIndices()
+    {
+        return m_shortIndices;
+    }
+
+    const std::vector<uint16_t>& VertexPool::getShortIndices() const
+    {
+        return m_shortIndices;
+    }
+
+    size_t VertexPool::getOriginsCount() const
+    {
+        return m_origins.size();
+    }
+
+    const TVec3d& VertexPool::getOrigin(size_t originIndex) const
+    {
+        return m_origins.at(originIndex);
+    }
+
+    size_t VertexPool::addOrigin(const TVec3d& origin)
+    {
+        m_origins.push_back(origin);
+        return m_origins.size() - 1;
+    }
+
+    size_t VertexPool::getThemesCount() const
+    {
+        return m_themes.size();
+    }
+
+    const std::string& VertexPool::getTheme(size_t themeIndex) const
+    {
+        return m_themes.at(themeIndex);
+    }
+
+    bool VertexPool::findTheme(const std::string& theme, size_t& themeIndex) const
+    {
+        // Documents have very few themes
+        auto it = std::find(m_themes.begin(), m_themes.end(), theme);
+        if (it == m_themes.end()) {
+            return false;
+        }
+        themeIndex = static_cast<size_t>(it - m_themes.begin());
+        return true;
+    }
+
+    size_t VertexPool::addTheme(const std::string& theme)
+    {
+        size_t themeIndex;
+        if (findTheme(theme, themeIndex)) {
+            return themeIndex;
+        }
+
+        m_themes.push_back(theme);
+        m_frontTexCoords.push_back(std::vector<TVec2f>());
+        m_backTexCoords.push_back(std::vector<TVec2f>());
+        return m_themes.size() - 1;
+    }
+
+    std::vector<TVec2f>& VertexPool::getTexCoords(size_t themeIndex, bool front)
+    {
+        return front ? m_frontTexCoords.at(themeIndex) : m_backTexCoords.at(themeIndex);
+    }
+
+    const std::vector<TVec2f>& VertexPool::getTexCoords(size_t themeIndex, bool front) const
+    {
+        return front ? m_frontTexCoords.at(themeIndex) : m_backTexCoords.at(themeIndex);
+    }
+
+}
@@ -0,0 +1,280 @@
+#include <citygml/weldedmesh.h>
+#include <citygml/polygon.h>
+#include <citygml/span.h>
+#include <citygml/texture.h>
+#include <citygml/material.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <map>
+
+namespace citygml {
+
+    namespace {
+
+        // The appearances of a polygon for all themes and sides, polygons with equal keys are welded into the same mesh
+        std::vector<const void*> getAppearanceKey(const Polygon& polygon, const std::vector<std::string>& themes)
+        {
+            std::vector<const void*> key;
+            key.reserve(themes.size() * 4);
+            for (const std::string& theme : themes) {
+                for (bool front : { true, false }) {
+                    key.push_back(polygon.getTextureFor(theme, front).get());
+                    key.push_back(polygon.getMaterialFor(theme, front).get());
+                }
+            }
+            return key;
+        }
+
+        const unsigned int NoVertex = ~0u;
+
+        struct CellKey {
+            int64_t x;
+            int64_t y;
+            int64_t z;
+
+            bool operator==(const CellKey& other) const
+            {
+                return x == other.x && y == other.y && z == other.z;
+            }
+        };
+
+        struct CellKeyHash {
+            size_t operator()(const CellKey& key) const
+            {
+                // Unsigned arithmetic as the products overflow for large cell indices
+                return std::hash<uint64_t>()(static_cast<uint64_t>(key.x) * 73856093u ^ static_cast<uint64_t>(key.y) * 19349663u
+                                             ^ static_cast<uint64_t>(key.z) * 83492791u);
+            }
+        };
+
+        // Cell indices are clamped (with room for the neighbour cells), e.g. for huge coordinates with a tiny tolerance or NaN. Vertices
+        // of the clamped cells are still compared with the tolerance.
+        const double MaxCellIndex = 4611686018427387904.0; // 2^62
+
+        int64_t getCellIndex(double coordinate, double cellSize)
+        {
+            const double index = std::floor(coordinate / cellSize);
+            if (!(index > -MaxCellIndex)) {
+                return -static_cast<int64_t>(MaxCellIndex);
+            }
+            if (!(index < MaxCellIndex)) {
+                return static_cast<int64_t>(MaxCellIndex);
+            }
+            return static_cast<int64_t>(index);
+        }
+
+        /**
+         * @brief The VertexWelder class merges vertices using a spatial hash with cells of the size of the tolerance
+         *
+         * The vertices of a cell are chained, a vertex is merged with a vertex of its own or of one of the 26 neighbour cells.
+         */
+        class VertexWelder {
+        public:
+            VertexWelder(std::vector<TVec3d>& vertices, std::vector<std::vector<TVec2f>*>& texCoordLists, double tolerance)
+                : m_vertices(vertices)
+                , m_texCoordLists(texCoordLists)
+                , m_tolerance(tolerance)
+                , m_cellSize(tolerance > 0.0 ? tolerance : 1e-6)
+            {
+
+            }
+
+            unsigned int addVertex(const TVec3d& position, const std::vector<TVec2f>& texCoords)
+            {
+                const CellKey cell = { getCellIndex(position.x, m_cellSize),
+                                       getCellIndex(position.y, m_cellSize),
+                                       getCellIndex(position.z, m_cellSize) };
+
+                for (int64_t dx = -1; dx <= 1; dx++) {
+                    for (int64_t dy = -1; dy <= 1; dy++) {
+                        for (int64_t dz = -1; dz <= 1; dz++) {
+                            const CellKey neighbour = { cell.x + dx, cell.y + dy, cell.z + dz };
+                            auto it = m_cells.find(neighbour);
+                            if (it == m_cells.end()) {
+                                continue;
+                            }
+                            for (unsigned int vertex = it->second; vertex != NoVertex; vertex = m_next[vertex]) {
+                                if (matches(vertex, position, texCoords)) {
+                                    return vertex;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                const unsigned int vertex = static_cast<unsigned int>(m_vertices.size());
+                m_vertices.push_back(position);
+                for (size_t i = 0; i < m_texCoordLists.size(); i++) {
+                    m_texCoordLists[i]->push_back(texCoords[i]);
+                }
+
+                auto inserted = m_cells.insert(std::make_pair(cell, vertex));
+                m_next.push_back(inserted.second ? NoVertex : inserted.first->second);
+                inserted.first->second = vertex;
+                return vertex;
+            }
+
+        private:
+            bool matches(unsigned int vertex, const TVec3d& position, const std::vector<TVec2f>& texCoords) const
+            {
+                const TVec3d& other = m_vertices[vertex];
+                if (std::fabs(other.x - position.x) > m_tolerance || std::fabs(other.y - position.y) > m_tolerance || std::fabs(other.z - position.z) > m_tolerance) {
+                    return false;
+                }
+
+                for (size_t i = 0; i < m_texCoordLists.size(); i++) {
+                    const TVec2f& otherTexCoord = (*m_texCoordLists[i])[vertex];
+                    if (otherTexCoord.x != texCoords[i].x || otherTexCoord.y != texCoords[i].y) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            std::vector<TVec3d>& m_vertices;
+            std::vector<std::vector<TVec2f>*>& m_texCoordLists;
+            double m_tolerance;
+            double m_cellSize;
+
+            // The last vertex added to a cell and the previous vertex of the same cell for each vertex
+            std::unordered_map<CellKey, unsigned int, CellKeyHash> m_cells;
+            std::vector<unsigned int> m_next;
+        };
+
+    }
+
+    WeldedMesh::WeldedMesh()
+    {
+
+    }
+
+    const std::vector<TVec3d>& WeldedMesh::getVertices() const
+    {
+        return m_vertices;
+    }
+
+    const std::vector<unsigned int>& WeldedMesh::getIndices() const
+    {
+        return m_indices;
+    }
+
+    const std::vector<TVec2f>& WeldedMesh::getTexCoordsForTheme(const std::string& theme, bool front) const
+    {
+        static const std::vector<TVec2f> empty;
+
+        const auto& map = front ? m_themeToFrontTexCoordsMap : m_themeToBackTexCoordsMap;
+        auto it = map.find(theme);
+        return it != map.end() ? it->second : empty;
+    }
+
+    std::shared_ptr<const Texture> WeldedMesh::getTextureFor(const std::string& theme, bool front) const
+    {
+        return m_polygonRanges.empty() ? nullptr : m_polygonRanges.front().polygon->getTextureFor(theme, front);
+    }
+
+    std::shared_ptr<const Material> WeldedMesh::getMaterialFor(const std::string& theme, bool front) const
+    {
+        return m_polygonRanges.empty() ? nullptr : m_polygonRanges.front().polygon->getMaterialFor(theme, front);
+    }
+
+    const std::vector<WeldedMesh::PolygonRange>& WeldedMesh::getPolygonRanges() const
+    {
+        return m_polygonRanges;
+    }
+
+    std::shared_ptr<const Polygon> WeldedMesh::getPolygonForTriangle(size_t triangle) const
+    {
+        const size_t index = triangle * 3;
+        if (index >= m_indices.size()) {
+            return nullptr;
+        }
+
+        auto it = std::upper_bound(m_polygonRanges.begin(), m_polygonRanges.end(), index, [](size_t value, const PolygonRange& range) {
+            return value < range.indexOffset;
+        });
+        return (it - 1)->polygon;
+    }
+
+    std::vector<std::shared_ptr<const WeldedMesh> > WeldedMesh::create(const std::vector<std::shared_ptr<const Polygon> >& polygons, const std::vector<std::string>& themes, double tolerance)
+    {
+        // Group the polygons by their appearances, the meshes are ordered by their first polygon
+        std::map<std::vector<const void*>, size_t> groupIndices;
+        std::vector<std::vector<std::shared_ptr<const Polygon> > > groups;
+        for (const std::shared_ptr<const Polygon>& polygon : polygons) {
+            if (polygon->getIndexCount() == 0) {
+                continue;
+            }
+
+            auto inserted = groupIndices.insert(std::make_pair(getAppearanceKey(*polygon, themes), groups.size()));
+            if (inserted.second) {
+                groups.push_back(std::vector<std::shared_ptr<const Polygon> >());
+            }
+            groups[inserted.first->second].push_back(polygon);
+        }
+
+        std::vector<std::shared_ptr<const WeldedMesh> > meshes;
+        for (const std::vector<std::shared_ptr<const Polygon> >& group : groups) {
+            std::shared_ptr<WeldedMesh> mesh(new WeldedMesh());
+
+            // All polygons of the group have the same textures, hence the same texture themes
+            std::vector<std::pair<std::string, bool> > texCoordThemes;
+            std::vector<std::vector<TVec2f>*> texCoordLists;
+            for (bool front : { true, false }) {
+                for (const std::string& theme : group.front()->getAllTextureThemes(front)) {
+                    texCoordThemes.push_back(std::make_pair(theme, front));
+                    texCoordLists.push_back(&(front ? mesh->m_themeToFrontTexCoordsMap : mesh->m_themeToBackTexCoordsMap)[theme]);
+                }
+            }
+
+            VertexWelder welder(mesh->m_vertices, texCoordLists, tolerance);
+            std::vector<unsigned int> weldedVertices;
+            std::vector<TVec2f> texCoords;
+            texCoords.reserve(texCoordLists.size());
+            std::vector<Span<const TVec2f> > polygonTexCoords(texCoordLists.size());
+
+            for (const std::shared_ptr<const Polygon>& polygon : group) {
+                const size_t vertexCount = polygon->getVertexCount();
+                for (size_t i = 0; i < texCoordThemes.size(); i++) {
+                    polygonTexCoords[i] = polygon->getTexCoordSpanForTheme(texCoordThemes[i].first, texCoordThemes[i].second);
+                }
+
+                weldedVertices.resize(vertexCount);
+                for (size_t v = 0; v < vertexCount; v++) {
+                    texCoords.clear();
+                    for (size_t i = 0; i < polygonTexCoords.size(); i++) {
+                        texCoords.push_back(polygonTexCoords[i].size() == vertexCount ? polygonTexCoords[i][v] : TVec2f(0.f, 0.f));
+                    }
+                    weldedVertices[v] = welder.addVertex(polygon->getVertex(v), texCoords);
+                }
+
+                PolygonRange range;
+                range.polygon = polygon;
+                range.indexOffset = mesh->m_indices.size();
+
+                const size_t indexCount = polygon->getIndexCount();
+                for (size_t i = 0; i + 2 < indexCount; i += 3) {
+                    const unsigned int a = weldedVertices[polygon->getIndex(i)];
+                    const unsigned int b = weldedVertices[polygon->getIndex(i + 1)];
+                    const unsigned int c = weldedVertices[polygon->getIndex(i + 2)];
+                    if (a == b || b == c || a == c) {
+                        continue;
+                    }
+                    mesh->m_indices.push_back(a);
+                    mesh->m_indices.push_back(b);
+                    mesh->m_indices.push_back(c);
+                }
+
+                range.indexCount = mesh->m_indices.size() - range.indexOffset;
+                mesh->m_polygonRanges.push_back(range);
+            }
+
+            meshes.push_back(mesh);
+        }
+
+        return meshes;
+    }
+
+}
@@ -1,12 +1,11 @@
 #include <parser/addressparser.h>
 #include <parser/documentlocation.h>
 #include <parser/attributes.h>
+#include <parser/characterdata.h>
 
 #include <citygml/address.h>
 #include <citygml/citygmllogger.h>
 
-#include <unordered_set>
-#include <unordered_map>
 #include <functional>
 
 namespace citygml {
@@ -42,39 +41,49 @@ namespace citygml {
             return std::unique_ptr<T>(new T(std::forward<Args>(args)...));
         }
 
-        auto k_rootElements = std::unordered_set<NodeType::XMLNode>();
-        auto k_subElements = std::unordered_set<NodeType::XMLNode>();
-        auto k_dataElements = std::unordered_map<NodeType::XMLNode, std::function<void(Address*, const std::string&)> >();
-
-        std::mutex g_nodeSetMutex;
-        bool g_nodeSetsInitialized = false;
-
-        void initializeNodeSets() {
-            if (!g_nodeSetsInitialized) {
-                std::lock_guard<std::mutex> lock(g_nodeSetMutex);
-                if (!g_nodeSetsInitialized) {
-                    k_rootElements = {
-                        NodeType::CORE_AddressNode,
-                        NodeType::BLDG_AddressNode,
-                        NodeType::CORE_XalAddressNode
-                    };
-
-                    k_subElements = {
-                        NodeType::XAL_AddressDetailsNode,
-                        NodeType::XAL_CountryNode,
-                        NodeType::XAL_LocalityNode,
-                        NodeType::XAL_PostalCodeNode,
-                        NodeType::XAL_ThoroughfareNode
-                    };
-
-					k_dataElements[NodeType::XAL_CountryNameNode] = &setCountry;
-					k_dataElements[NodeType::XAL_LocalityNameNode] = &setLocality;
-					k_dataElements[NodeType::XAL_ThoroughfareNameNode] = &setThoroughfareName;
-					k_dataElements[NodeType::XAL_ThoroughfareNumberNode] = &setThoroughfareNumber;
-					k_dataElements[NodeType::XAL_PostalCodeNumberNode] = &setPostalCode;
-
-                    g_nodeSetsInitialized = true;
-                }
+        typedef void (*DataElementSetter)(Address*, const std::string&);
+
+        bool isRootElement(const NodeType::XMLNode& node) {
+            switch (node.typeID()) {
+            case NodeType::CORE_AddressTypeID:
+            case NodeType::BLDG_AddressTypeID:
+            case NodeType::CORE_XalAddressTypeID:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        bool isSubElement(const NodeType::XMLNode& node) {
+            switch (node.typeID()) {
+            case NodeType::XAL_AddressDetailsTypeID:
+            case NodeType::XAL_CountryTypeID:
+            case NodeType::XAL_LocalityTypeID:
+            case NodeType::XAL_PostalCodeTypeID:
+            case NodeType::XAL_ThoroughfareTypeID:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        /**
+         * @brief returns the setter for the character data of the node or nullptr if the node is not a data element
+         */
+        DataElementSetter getDataElementSetter(const NodeType::XMLNode& node) {
+            switch (node.typeID()) {
+            case NodeType::XAL_CountryNameTypeID:
+                return &setCountry;
+            case NodeType::XAL_LocalityNameTypeID:
+                return &setLocality;
+            case NodeType::XAL_ThoroughfareNameTypeID:
+                return &setThoroughfareName;
+            case NodeType::XAL_ThoroughfareNumberTypeID:
+                return &setThoroughfareNumber;
+            case NodeType::XAL_PostalCodeNumberTypeID:
+                return &setPostalCode;
+            default:
+                return nullptr;
             }
         }
 
@@ -84,7 +93,6 @@ namespace citygml {
     : CityGMLElementParser(documentParser, factory, logger)
     , m_callback(callback)
     {
-        initializeNodeSets();
     }
 
     std::string AddressParser::elementParserName() const
@@ -94,41 +102,41 @@ namespace citygml {
 
     bool AddressParser::handlesElement(const NodeType::XMLNode& node) const
     {
-        return k_rootElements.count(node) > 0;
+        return isRootElement(node);
     }
 
     bool AddressParser::parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
     {
-        if (k_rootElements.count(node) == 0) {
+        if (!isRootElement(node)) {
             CITYGML_LOG_ERROR(m_logger, "Expected an address start tag but got <" << node << "> at " << getDocumentLocation());
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_address = citygml::make_unique<Address>(attributes.getCityGMLIDAttribute());
+        m_address = citygml::make_unique<Address>(getObjectID(attributes));
         return true;
     }
 
-    bool AddressParser::parseElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool AddressParser::parseElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         m_callback(std::move(m_address));
         m_address = nullptr;
-        return k_rootElements.count(node) > 0;
+        return isRootElement(node);
     }
 
     bool AddressParser::parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
     {
-        return k_subElements.count(node) > 0 || k_dataElements.count(node) > 0 || k_rootElements.count(node) > 0;
+        return isSubElement(node) || getDataElementSetter(node) != nullptr || isRootElement(node);
     }
 
-    bool AddressParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool AddressParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
-        const auto itr = k_dataElements.find(node);
-        if (itr != k_dataElements.end()) {
-            itr->second(m_address.get(), characters);
+        const DataElementSetter setter = getDataElementSetter(node);
+        if (setter != nullptr) {
+            setter(m_address.get(), characters);
             return true;
         }
 
-        return k_subElements.count(node) > 0 || k_dataElements.count(node) > 0 || k_rootElements.count(node) > 0;
+        return isSubElement(node) || isRootElement(node);
     }
 
 } /* namespace citygml */
@@ -5,6 +5,7 @@
 
 #include "parser/nodetypes.h"
 #include "parser/attributes.h"
+#include "parser/characterdata.h"
 #include "parser/documentlocation.h"
 #include "parser/delayedchoiceelementparser.h"
 #include "parser/textureelementparser.h"
@@ -47,11 +48,11 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_appearanceObj = std::make_shared<Object>(attributes.getCityGMLIDAttribute());
+        m_appearanceObj = std::make_shared<Object>(getObjectID(attributes));
         return true;
     }
 
-    bool AppearanceElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool AppearanceElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         if (m_theme.empty()) {
             CITYGML_LOG_INFO(m_logger, "Appearance node that ends at " << getDocumentLocation() << " has not theme defined. Using empty theme.");
@@ -75,28 +76,31 @@ namespace citygml {
             return true;
         } else if (node == NodeType::APP_SurfaceDataMemberNode) {
 
-            if (attributes.hasXLinkAttribute()) {
+            std::string surfaceDataID;
+            if (attributes.getXLinkReference(surfaceDataID)) {
                 // surfaceDataMemberNode links to an existing surfaceData member
 
-                std::shared_ptr<Appearance> sharedAppearance = m_factory.getAppearanceWithID(attributes.getXLinkValue());
+                std::shared_ptr<Appearance> sharedAppearance = m_factory.getAppearanceWithID(surfaceDataID);
                 if (sharedAppearance != nullptr) {
                     m_surfaceDataList.push_back(sharedAppearance);
                 } else {
-                    CITYGML_LOG_WARN(m_logger, "SurfaceDataMember node with invalid xlink attribute. SurfaceData object with id " << attributes.getXLinkValue() << " does not exist.");
+                    CITYGML_LOG_WARN(m_logger, "SurfaceDataMember node with invalid xlink attribute. SurfaceData object with id " << surfaceDataID << " does not exist.");
                 }
             } else {
                 // surfaceDataMemberNode contains a surfaceData object (material, texture or georeferencedtexture)
 
-                std::function<void(std::shared_ptr<Appearance>)> callback = [this] (std::shared_ptr<Appearance> surfacedata) {
-                    this->m_surfaceDataList.push_back(surfacedata);
-                };
-
-                std::vector<ElementParser*> choices;
-                choices.push_back(new MaterialElementParser(m_documentParser, m_factory, m_logger, callback));
-                choices.push_back(new TextureElementParser(m_documentParser, m_factory, m_logger, callback));
-                choices.push_back(new GeoReferencedTextureElementParser(m_documentParser, m_factory, m_logger, callback));
-
-                setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, choices));
+                std::vector<DelayedChoiceElementParser::Choice> choices;
+                choices.emplace_back("MaterialElementParser", &MaterialElementParser::isRootElement, [this]() -> ElementParser* {
+                    return new MaterialElementParser(m_documentParser, m_factory, m_logger, [this](std::shared_ptr<Appearance> surfaceData) { m_surfaceDataList.push_back(surfaceData); });
+                });
+                choices.emplace_back("TextureElementParser", &TextureElementParser::isRootElement, [this]() -> ElementParser* {
+                    return new TextureElementParser(m_documentParser, m_factory, m_logger, [this](std::shared_ptr<Appearance> surfaceData) { m_surfaceDataList.push_back(surfaceData); });
+                });
+                choices.emplace_back("GeoReferencedTextureElementParser", &GeoReferencedTextureElementParser::isRootElement, [this]() -> ElementParser* {
+                    return new GeoReferencedTextureElementParser(m_documentParser, m_factory, m_logger, [this](std::shared_ptr<Appearance> surfaceData) { m_surfaceDataList.push_back(surfaceData); });
+                });
+
+                setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, std::move(choices)));
             }
             return true;
 
@@ -104,7 +108,7 @@ namespace citygml {
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool AppearanceElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool AppearanceElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (node == NodeType::APP_ThemeNode) {
             if (!m_theme.empty()) {
@@ -1,5 +1,4 @@
 #include "parser/attributes.h"
-#include "parser/parserutils.hpp"
 #include "parser/documentlocation.h"
 
 #include <citygml/citygmllogger.h>
@@ -8,32 +7,76 @@
 
 namespace citygml {
 
+    const char* getAttributeQName(AttributeName name)
+    {
+        switch (name) {
+        case AttributeName::GMLID:
+            return "gml:id";
+        case AttributeName::XLinkHref:
+            return "xlink:href";
+        case AttributeName::SRSName:
+            return "srsName";
+        case AttributeName::SRSDimension:
+            return "srsDimension";
+        case AttributeName::Orientation:
+            return "orientation";
+        case AttributeName::Name:
+            return "name";
+        case AttributeName::Uri:
+            return "uri";
+        case AttributeName::Ring:
+            return "ring";
+        default:
+            return "";
+        }
+    }
+
     Attributes::Attributes(std::shared_ptr<CityGMLLogger> logger)
     {
         m_logger = logger;
     }
 
-    std::string Attributes::getCityGMLIDAttribute() const
+    bool Attributes::findAttribute(AttributeName name, std::string& value) const
+    {
+        value = getAttribute(getAttributeQName(name), "");
+        return !value.empty();
+    }
+
+    std::string Attributes::getAttribute(AttributeName name, const std::string& defvalue) const
     {
-        std::string id = getAttribute("gml:id", "");
-        if (id.empty()) {
-            std::stringstream defaultID;
-            defaultID << "genID_" << getDocumentLocation().getDocumentFileName() << "_" << getDocumentLocation().getCurrentLine() << "_" << + getDocumentLocation().getCurrentColumn();
-            id = defaultID.str();
+        std::string value;
+        if (!findAttribute(name, value)) {
+            return defvalue;
         }
-        return id;
+        return value;
     }
 
-    bool Attributes::hasXLinkAttribute() const
+    std::string Attributes::getCityGMLIDAttribute() const
     {
-        return !getAttribute("xlink:href", "").empty();
+        std::string id;
+        if (!findAttribute(AttributeName::GMLID, id)) {
+            id = getDefaultCityGMLID();
+        }
+        return id;
     }
 
-    std::string Attributes::getXLinkValue()
+    std::string Attributes::getDefaultCityGMLID() const
     {
-        return parseReference(getAttribute("xlink:href", ""), m_logger, getDocumentLocation());
+        std::stringstream defaultID;
+        defaultID << "genID_" << getDocumentLocation().getDocumentFileName() << "_" << getDocumentLocation().getCurrentLine() << "_" << + getDocumentLocation().getCurrentColumn();
+        return defaultID.str();
     }
 
+    bool Attributes::getXLinkReference(std::string& reference) const
+    {
+        if (!findAttribute(AttributeName::XLinkHref, reference)) {
+            return false;
+        }
 
+        if (reference[0] == '#') {
+            reference.erase(0, 1);
+        }
+        return true;
+    }
 
 }
@@ -0,0 +1,102 @@
+#include "parser/characterdata.h"
+
+namespace citygml {
+
+    CharacterData::CharacterData()
+        : m_text(nullptr)
+        , m_begin(nullptr)
+        , m_end(nullptr)
+        , m_isTranscoded(false)
+    {
+
+    }
+
+    CharacterData::CharacterData(const std::string& text)
+        : m_text(&text)
+        , m_begin(nullptr)
+        , m_end(nullptr)
+        , m_isTranscoded(false)
+    {
+
+    }
+
+    CharacterData::CharacterData(const char16_t* begin, const char16_t* end)
+        : m_text(nullptr)
+        , m_begin(begin)
+        , m_end(end)
+        , m_isTranscoded(false)
+    {
+
+    }
+
+    CharacterData::~CharacterData()
+    {
+
+    }
+
+    bool CharacterData::empty() const
+    {
+        if (m_text != nullptr) {
+            return m_text->empty();
+        }
+        return m_begin == m_end;
+    }
+
+    const std::string& CharacterData::str() const
+    {
+        if (m_text != nullptr) {
+            return *m_text;
+        }
+
+        if (!m_isTranscoded) {
+            m_transcoded = m_begin != m_end ? transcode(m_begin, m_end) : std::string();
+            m_isTranscoded = true;
+        }
+        return m_transcoded;
+    }
+
+    CharacterData::operator const std::string&() const
+    {
+        return str();
+    }
+
+    std::string CharacterData::transcode(const char16_t* begin, const char16_t* end) const
+    {
+        std::string result;
+        result.reserve(static_cast<size_t>(end - begin));
+
+        for (const char16_t* it = begin; it != end; ++it) {
+            char32_t c = *it;
+            if (c < 0x80) {
+                // Fast path for ASCII text (e.g. numbers)
+                result.push_back(static_cast<char>(c));
+                continue;
+            }
+
+            if (c >= 0xD800 && c <= 0xDBFF && it + 1 != end && it[1] >= 0xDC00 && it[1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (it[1] - 0xDC00);
+                ++it;
+            }
+
+            if (c < 0x800) {
+                result.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            } else if (c < 0x10000) {
+                result.push_back(static_cast<char>(0xE0 | (c >> 12)));
+                result.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            } else {
+                result.push_back(static_cast<char>(0xF0 | (c >> 18)));
+                result.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+                result.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            }
+            result.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+
+        return result;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const CharacterData& characters)
+    {
+        return os << characters.str();
+    }
+
+}
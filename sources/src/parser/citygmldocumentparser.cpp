@@ -1,5 +1,7 @@
 #include "parser/citygmldocumentparser.h"
 #include "parser/documentlocation.h"
+#include "parser/characterdata.h"
+#include "parser/attributes.h"
 #include "parser/nodetypes.h"
 #include "parser/elementparser.h"
 #include "parser/citymodelelementparser.h"
@@ -9,7 +11,14 @@
 #include <citygml/citygmlfactory.h>
 #include <citygml/citymodel.h>
 #include <citygml/tesselator.h>
-
+#include <citygml/earclippingtesselator.h>
+#include <citygml/geometry.h>
+#include <citygml/polygon.h>
+#include <citygml/loadstatistics.h>
+#include <citygml/tracing.h>
+#include <citygml/objectarena.h>
+
+#include <algorithm>
 #include <stdexcept>
 
 namespace citygml {
@@ -17,12 +26,20 @@ namespace citygml {
     CityGMLDocumentParser::CityGMLDocumentParser(const ParserParams& params, std::shared_ptr<CityGMLLogger> logger)
     {
         m_logger = logger;
-        m_factory = std::unique_ptr<CityGMLFactory>(new CityGMLFactory(logger));
+        m_factory = std::unique_ptr<CityGMLFactory>(new CityGMLFactory(logger, params.objectArena));
         m_parserParams = params;
         m_activeParser = nullptr;
+        m_documentChunk = false;
+        m_documentIndex = 0;
+        m_generatedIDCount = 0;
         m_currentElementUnknownOrUnexpected = false;
         m_unknownElementOrUnexpectedElementDepth = 0;
-        m_unknownElementOrUnexpectedElementName = "";
+        updateEnabledLogLevels();
+
+        if (params.statistics != nullptr) {
+            m_statistics = std::unique_ptr<LoadStatistics>(new LoadStatistics());
+            m_elementCounts.assign(NodeType::TypeIDCount, std::make_pair(nullptr, 0));
+        }
     }
 
     std::shared_ptr<const CityModel> CityGMLDocumentParser::getModel()
@@ -30,79 +47,320 @@ namespace citygml {
         return m_rootModel;
     }
 
+    void CityGMLDocumentParser::setCityObjectCallback(CityObjectCallback callback)
+    {
+        m_cityObjectCallback = callback;
+    }
+
+    void CityGMLDocumentParser::setDocumentChunk(uint32_t chunkIndex)
+    {
+        m_documentChunk = true;
+        m_documentIndex = chunkIndex;
+    }
+
+    void CityGMLDocumentParser::mergeDocumentChunk(CityGMLDocumentParser& chunk)
+    {
+        if (chunk.m_rootModel == nullptr) {
+            CITYGML_LOG_WARN(m_logger, "Merging document chunk without CityModel.");
+        } else if (m_rootModel == nullptr) {
+            m_rootModel = chunk.m_rootModel;
+            chunk.m_rootModel = nullptr;
+        } else {
+            m_factory->mergeCityModels(*m_rootModel, *chunk.m_rootModel);
+            chunk.m_rootModel = nullptr;
+        }
+
+        m_factory->mergeFactory(*chunk.m_factory);
+
+        if (m_statistics != nullptr && chunk.m_statistics != nullptr) {
+            // The chunks are parsed in parallel
+            m_statistics->parsing.wallTime = std::max(m_statistics->parsing.wallTime, chunk.m_statistics->parsing.wallTime);
+            m_statistics->parsing.cpuTime = std::max(m_statistics->parsing.cpuTime, chunk.m_statistics->parsing.cpuTime);
+            m_statistics->elements += chunk.m_statistics->elements;
+            m_statistics->unknownElements += chunk.m_statistics->unknownElements;
+            for (size_t i = 0; i < m_elementCounts.size(); i++) {
+                if (chunk.m_elementCounts[i].first != nullptr) {
+                    m_elementCounts[i].first = chunk.m_elementCounts[i].first;
+                    m_elementCounts[i].second += chunk.m_elementCounts[i].second;
+                }
+            }
+        }
+    }
+
+    void CityGMLDocumentParser::addRootCityObject(CityModel& model, CityObject* obj)
+    {
+        if (!m_cityObjectCallback) {
+            model.addRootObject(obj);
+            return;
+        }
+
+        std::unique_ptr<CityObject> object(obj);
+
+        if (!m_factory->closeCityObject(*object)) {
+            CITYGML_LOG_DEBUG(m_logger, "CityObject with id '" << object->getId() << "' references objects that are not parsed yet. It is passed to the callback at the end of the document.");
+            m_deferredCityObjects.push_back(std::move(object));
+            return;
+        }
+
+        streamCityObject(std::move(object), model);
+    }
+
+    std::unique_ptr<TesselatorBase> CityGMLDocumentParser::createTesselator() const
+    {
+        std::unique_ptr<TesselatorBase> tesselator;
+        if (m_parserParams.tesselatorType == TesselatorType::EarClipping) {
+            tesselator = std::unique_ptr<TesselatorBase>(new EarClippingTesselator(m_logger));
+        } else {
+            tesselator = std::unique_ptr<TesselatorBase>(new Tesselator(m_logger));
+        }
+        tesselator->setKeepVertices(m_parserParams.keepVertices);
+        return tesselator;
+    }
+
+    void CityGMLDocumentParser::streamCityObject(std::unique_ptr<CityObject> obj, const CityModel& model)
+    {
+        if (m_streamTesselator == nullptr) {
+            m_streamTesselator = createTesselator();
+        }
+        PhaseTimer timer(m_statistics != nullptr);
+        obj->finish(*m_streamTesselator, m_parserParams.optimize, m_logger);
+
+        if (m_statistics != nullptr) {
+            timer.addTo(m_statistics->finishing);
+            addCityObjectStatistics(*obj);
+        }
+
+        if (!m_parserParams.destSRS.empty()) {
+            timer.restart(m_statistics != nullptr);
+            if (m_streamTransformer == nullptr) {
+                m_streamTransformer = std::unique_ptr<GeoCoordinateTransformer>(new GeoCoordinateTransformer(m_parserParams.destSRS, m_logger));
+            }
+            m_streamTransformer->transformToDestinationSRS(*obj, model.getEnvelope().srsName());
+            if (m_statistics != nullptr) {
+                timer.addTo(m_statistics->transformation);
+            }
+        }
+
+        if (m_parserParams.weldVertices) {
+            obj->createWeldedMeshes(m_factory->getAllThemes(), m_parserParams.weldTolerance);
+        }
+
+        m_cityObjectCallback(std::move(obj));
+    }
+
+    void CityGMLDocumentParser::addCityObjectStatistics(const CityObject& obj)
+    {
+        m_statistics->cityObjects++;
+        m_statistics->cityObjectsByType[obj.getType()]++;
+
+        for (unsigned int i = 0; i < obj.getGeometriesCount(); i++) {
+            addGeometryStatistics(obj.getGeometry(i));
+        }
+
+        for (unsigned int i = 0; i < obj.getChildCityObjectsCount(); i++) {
+            addCityObjectStatistics(obj.getChildCityObject(i));
+        }
+    }
+
+    void CityGMLDocumentParser::addGeometryStatistics(const Geometry& geom)
+    {
+        for (unsigned int i = 0; i < geom.getPolygonsCount(); i++) {
+            std::shared_ptr<const Polygon> polygon = geom.getPolygon(i);
+            m_statistics->polygons++;
+            m_statistics->vertices += polygon->getVertexCount();
+            m_statistics->triangles += polygon->getIndexCount() / 3;
+        }
+
+        for (unsigned int i = 0; i < geom.getGeometriesCount(); i++) {
+            addGeometryStatistics(geom.getGeometry(i));
+        }
+    }
+
+    void CityGMLDocumentParser::publishStatistics()
+    {
+        m_statistics->resolvedXLinks = m_factory->getResolvedXLinksCount();
+        m_statistics->unresolvedXLinks = m_factory->getUnresolvedXLinksCount();
+
+        for (const std::pair<const NodeType::XMLNode*, uint64_t>& count : m_elementCounts) {
+            if (count.first != nullptr) {
+                m_statistics->elementsByName[count.first->name()] = count.second;
+            }
+        }
+
+        *m_parserParams.statistics = *m_statistics;
+    }
+
+    ObjectID CityGMLDocumentParser::getObjectID(const Attributes& attributes)
+    {
+        std::string id;
+        if (attributes.findAttribute(AttributeName::GMLID, id)) {
+            return ObjectID(std::move(id));
+        }
+
+        if (!m_parserParams.compactIDs) {
+            return ObjectID(attributes.getDefaultCityGMLID());
+        }
+
+        return ObjectID::generate(m_documentIndex, ++m_generatedIDCount);
+    }
+
     void CityGMLDocumentParser::setCurrentElementParser(ElementParser* parser)
     {
-        m_parserStack.push(std::shared_ptr<ElementParser>(parser));
+        m_parserStack.push_back(std::unique_ptr<ElementParser>(parser));
     }
 
     void CityGMLDocumentParser::removeCurrentElementParser(const ElementParser* caller)
     {
-        if (m_parserStack.top().get() != caller) {
+        if (m_parserStack.empty() || m_parserStack.back().get() != caller) {
             throw std::runtime_error("A CityGMLElementParser object tries to remove another CityGMLElementParser object from the control flow which is not allowed.");
         }
-        m_parserStack.pop();
+        m_removedParsers.push_back(std::move(m_parserStack.back()));
+        m_parserStack.pop_back();
+    }
+
+    const ParserParams& CityGMLDocumentParser::getParserParams() const
+    {
+        return m_parserParams;
+    }
+
+    bool CityGMLDocumentParser::isCharacterDataRequired() const
+    {
+        if (m_currentElementUnknownOrUnexpected || m_parserStack.empty()) {
+            return false;
+        }
+        return m_parserStack.back()->requiresCharacterData();
     }
 
     void CityGMLDocumentParser::startElement(const std::string& name, Attributes& attributes)
     {
-        if (checkCurrentElementUnownOrUnexpected_start(name)) {
-            CITYGML_LOG_DEBUG(m_logger, "Skipping element <" << name << "> at " << getDocumentLocation());
+        if (m_statistics != nullptr) {
+            m_statistics->elements++;
+        }
+
+        if (checkCurrentElementUnownOrUnexpected_start()) {
+            CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_DEBUG), m_logger, CityGMLLogger::LOGLEVEL::LL_DEBUG, "Skipping element <" << name << "> at " << getDocumentLocation());
             return;
         }
 
         const NodeType::XMLNode& node = NodeType::getXMLNodeFor(name);
 
         if (!node.valid()) {
-            CITYGML_LOG_WARN(m_logger, "Found start tag of unknown node <" << name << "> at " << getDocumentLocation() << ". Skip to next element.");
-            skipUnknownOrUnexpectedElement(name);
+            if (m_statistics != nullptr) {
+                m_statistics->unknownElements++;
+            }
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_UNKNOWN_ELEMENT, "Found start tag of unknown node <" << name << "> at " << getDocumentLocation() << ". Skip to next element.");
+            skipUnknownOrUnexpectedElement();
             return;
         }
 
+        startKnownElement(node, attributes);
+    }
+
+    void CityGMLDocumentParser::startElement(const NodeType::XMLNode& node, Attributes& attributes)
+    {
+        if (m_statistics != nullptr) {
+            m_statistics->elements++;
+        }
+
+        if (checkCurrentElementUnownOrUnexpected_start()) {
+            CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_DEBUG), m_logger, CityGMLLogger::LOGLEVEL::LL_DEBUG, "Skipping element <" << node << "> at " << getDocumentLocation());
+            return;
+        }
+
+        startKnownElement(node, attributes);
+    }
+
+    void CityGMLDocumentParser::startKnownElement(const NodeType::XMLNode& node, Attributes& attributes)
+    {
         if (m_parserStack.empty()) {
-            m_parserStack.push(std::unique_ptr<CityModelElementParser>(new CityModelElementParser(*this, *m_factory, m_logger, [this](CityModel* cityModel) {
-                this->m_rootModel = std::unique_ptr<CityModel>(cityModel);
+            m_parserStack.push_back(std::unique_ptr<CityModelElementParser>(new CityModelElementParser(*this, *m_factory, m_logger, [this](CityModel* cityModel) {
+                this->m_rootModel = ObjectArena::share(cityModel);
             })));
         }
 
-        m_activeParser = m_parserStack.top();
-        CITYGML_LOG_TRACE(m_logger, "Invoke " << m_activeParser->elementParserName() << "::startElement for <" << node << "> at " << getDocumentLocation());
+        if (!m_elementCounts.empty()) {
+            m_elementCounts[node.typeID()].first = &node;
+            m_elementCounts[node.typeID()].second++;
+        }
+
+        m_activeParser = m_parserStack.back().get();
+        CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_TRACE), m_logger, CityGMLLogger::LOGLEVEL::LL_TRACE, "Invoke " << m_activeParser->elementParserName() << "::startElement for <" << node << "> at " << getDocumentLocation());
         if (!m_activeParser->startElement(node, attributes)) {
-            CITYGML_LOG_WARN(m_logger, "Skipping element with unexpected start tag <" << node << "> at " << getDocumentLocation() << " (active parser " << m_activeParser->elementParserName() << ")");
-            skipUnknownOrUnexpectedElement(name);
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_UNEXPECTED_ELEMENT, "Skipping element with unexpected start tag <" << node << "> at " << getDocumentLocation() << " (active parser " << m_activeParser->elementParserName() << ")");
+            skipUnknownOrUnexpectedElement();
         }
+
+        releaseRemovedParsers();
     }
 
     void CityGMLDocumentParser::endElement(const std::string& name, const std::string& characters)
     {
-        if (checkCurrentElementUnownOrUnexpected_end(name)) {
-            CITYGML_LOG_DEBUG(m_logger, "Skipped element <" << name << "> at " << getDocumentLocation());
+        if (checkCurrentElementUnownOrUnexpected_end()) {
+            CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_DEBUG), m_logger, CityGMLLogger::LOGLEVEL::LL_DEBUG, "Skipped element <" << name << "> at " << getDocumentLocation());
             return;
         }
 
         const NodeType::XMLNode& node = NodeType::getXMLNodeFor(name);
 
         if (!node.valid()) {
-            CITYGML_LOG_WARN(m_logger, "Found end tag of unknown node <" << name << "> at " << getDocumentLocation());
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_UNKNOWN_ELEMENT, "Found end tag of unknown node <" << name << "> at " << getDocumentLocation());
+            return;
+        }
+
+        endKnownElement(node, CharacterData(characters));
+    }
+
+    void CityGMLDocumentParser::endElement(const NodeType::XMLNode& node, const CharacterData& characters)
+    {
+        if (checkCurrentElementUnownOrUnexpected_end()) {
+            CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_DEBUG), m_logger, CityGMLLogger::LOGLEVEL::LL_DEBUG, "Skipped element <" << node << "> at " << getDocumentLocation());
             return;
         }
 
+        endKnownElement(node, characters);
+    }
+
+    void CityGMLDocumentParser::endKnownElement(const NodeType::XMLNode& node, const CharacterData& characters)
+    {
         if (m_parserStack.empty()) {
             CITYGML_LOG_ERROR(m_logger, "Found element end tag at" << getDocumentLocation() << "but parser stack is empty (either a bug or corrupted xml document)");
             throw std::runtime_error("Unexpected element end.");
         }
 
-        m_activeParser = m_parserStack.top();
-        CITYGML_LOG_TRACE(m_logger, "Invoke " << m_activeParser->elementParserName() << "::endElement for <" << node << "> at " << getDocumentLocation());
+        m_activeParser = m_parserStack.back().get();
+        CITYGML_LOG_IF(isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_TRACE), m_logger, CityGMLLogger::LOGLEVEL::LL_TRACE, "Invoke " << m_activeParser->elementParserName() << "::endElement for <" << node << "> at " << getDocumentLocation());
         if (!m_activeParser->endElement(node, characters)) {
             CITYGML_LOG_ERROR(m_logger, "Active parser " << m_activeParser->elementParserName() << " reports end tag <" << node << "> at " << getDocumentLocation() << " as "
                               << "unknown, but it seems as if the corresponding start tag was not reported as unknown. Please check the parser implementation."
                               << "Ignoring end tag and continue parsing.");
         }
 
+        releaseRemovedParsers();
+    }
+
+    void CityGMLDocumentParser::releaseRemovedParsers()
+    {
+        // The memory of the parsers is recycled for the parsers of the next elements (see ElementParser::operator new)
+        m_activeParser = nullptr;
+        m_removedParsers.clear();
+    }
+
+    void CityGMLDocumentParser::updateEnabledLogLevels()
+    {
+        m_enabledLogLevels = 0;
+        for (CityGMLLogger::LOGLEVEL level : {CityGMLLogger::LOGLEVEL::LL_TRACE, CityGMLLogger::LOGLEVEL::LL_DEBUG, CityGMLLogger::LOGLEVEL::LL_INFO,
+                                              CityGMLLogger::LOGLEVEL::LL_WARNING, CityGMLLogger::LOGLEVEL::LL_ERROR}) {
+            if (CITYGML_LOG_LEVEL_COMPILED_IN(level) && m_logger->isEnabledFor(level)) {
+                m_enabledLogLevels |= 1u << static_cast<unsigned int>(level);
+            }
+        }
     }
 
     void CityGMLDocumentParser::startDocument()
     {
+        updateEnabledLogLevels();
+        m_parseTimer.restart(m_statistics != nullptr);
+        CITYGML_TRACE_BEGIN("parse document");
         CITYGML_LOG_INFO(m_logger, "Start parsing citygml file (" << getDocumentLocation() << ")");
     }
 
@@ -114,23 +372,61 @@ namespace citygml {
 
         CITYGML_LOG_INFO(m_logger, "Finished parsing ciytgml file (" << getDocumentLocation() << ")");
 
+        CITYGML_TRACE_END("parse document");
+        if (m_statistics != nullptr) {
+            m_parseTimer.addTo(m_statistics->parsing);
+        }
+
+        if (!m_documentChunk) {
+            finishDocument();
+        }
+    }
+
+    void CityGMLDocumentParser::finishDocument()
+    {
+        CITYGML_TRACE_SCOPE("finish document");
+
+        PhaseTimer timer(m_statistics != nullptr);
         m_factory->closeFactory();
+        if (m_statistics != nullptr) {
+            timer.addTo(m_statistics->resolving);
+        }
 
         if (m_rootModel != nullptr) {
-            Tesselator tesselator(m_logger);
-            tesselator.setKeepVertices(m_parserParams.keepVertices);
+            std::unique_ptr<TesselatorBase> tesselator = createTesselator();
 
             CITYGML_LOG_INFO(m_logger, "Start postprocessing of the citymodel.");
-            m_rootModel->finish(tesselator, m_parserParams.optimize, m_logger);
+            timer.restart(m_statistics != nullptr);
+            m_rootModel->finish(*tesselator, m_parserParams.optimize, m_logger, m_parserParams.threadCount);
             CITYGML_LOG_INFO(m_logger, "Finished postprocessing of the citymodel.");
 
+            if (m_statistics != nullptr) {
+                timer.addTo(m_statistics->finishing);
+                for (unsigned int i = 0; i < m_rootModel->getNumRootCityObjects(); i++) {
+                    addCityObjectStatistics(m_rootModel->getRootCityObject(i));
+                }
+            }
+
             m_rootModel->setThemes(m_factory->getAllThemes());
 
+            // The deferred objects must be transformed before the model envelope (which defines their default srs)
+            if (!m_deferredCityObjects.empty()) {
+                CITYGML_LOG_INFO(m_logger, "Passing " << m_deferredCityObjects.size() << " deferred CityObjects to the callback.");
+                for (std::unique_ptr<CityObject>& obj : m_deferredCityObjects) {
+                    streamCityObject(std::move(obj), *m_rootModel);
+                }
+                m_deferredCityObjects.clear();
+            }
+
             if (!m_parserParams.destSRS.empty()) {
                 try {
                     CITYGML_LOG_INFO(m_logger, "Start coordinates transformation .");
+                    timer.restart(m_statistics != nullptr);
                     GeoCoordinateTransformer transformer(m_parserParams.destSRS, m_logger);
                     transformer.transformToDestinationSRS(m_rootModel.get());
+                    if (m_statistics != nullptr) {
+                        timer.addTo(m_statistics->transformation);
+                    }
                     CITYGML_LOG_INFO(m_logger, "Finished coordinates transformation .");
                 } catch (const std::runtime_error& e) {
                     CITYGML_LOG_ERROR(m_logger, "Coordinate transformation aborted: " << e.what());
@@ -138,45 +434,54 @@ namespace citygml {
                 }
             }
 
+            // The meshes are welded in the destination SRS (the tolerance applies to the final coordinates)
+            if (m_parserParams.weldVertices) {
+                m_rootModel->createWeldedMeshes(m_parserParams.weldTolerance);
+            }
+
+            // The polygons are moved last as the transformation works on the vertices of the polygons
+            if (m_parserParams.vertexPools || m_parserParams.compactVertices) {
+                m_rootModel->createVertexPool(m_parserParams.compactVertices);
+            }
+
         } else {
             CITYGML_LOG_WARN(m_logger, "Reached end of document but no CityModel was parsed.");
         }
+
+        if (m_statistics != nullptr) {
+            publishStatistics();
+        }
     }
 
-    void CityGMLDocumentParser::skipUnknownOrUnexpectedElement(const std::string& name)
+    void CityGMLDocumentParser::skipUnknownOrUnexpectedElement()
     {
-        m_unknownElementOrUnexpectedElementName = name;
         m_unknownElementOrUnexpectedElementDepth = 0;
         m_currentElementUnknownOrUnexpected = true;
     }
 
-    bool CityGMLDocumentParser::checkCurrentElementUnownOrUnexpected_start(const std::string& name)
+    bool CityGMLDocumentParser::checkCurrentElementUnownOrUnexpected_start()
     {
         if (!m_currentElementUnknownOrUnexpected) {
             return false;
         }
 
-        if (m_unknownElementOrUnexpectedElementName == name) {
-            m_unknownElementOrUnexpectedElementDepth++;
-        }
+        // The document is well formed, hence counting the nesting depth of all elements finds the end tag of the skipped element
+        m_unknownElementOrUnexpectedElementDepth++;
 
         return true;
     }
 
-    bool CityGMLDocumentParser::checkCurrentElementUnownOrUnexpected_end(const std::string& name)
+    bool CityGMLDocumentParser::checkCurrentElementUnownOrUnexpected_end()
     {
         if (!m_currentElementUnknownOrUnexpected) {
             return false;
         }
 
-        if (m_unknownElementOrUnexpectedElementName == name) {
-            if (m_unknownElementOrUnexpectedElementDepth == 0) {
-                // End tag of initial unknown element reached...
-                m_unknownElementOrUnexpectedElementName = "";
-                m_currentElementUnknownOrUnexpected = false;
-            }
-            m_unknownElementOrUnexpectedElementDepth--;
+        if (m_unknownElementOrUnexpectedElementDepth == 0) {
+            // End tag of initial unknown element reached...
+            m_currentElementUnknownOrUnexpected = false;
         }
+        m_unknownElementOrUnexpectedElementDepth--;
 
         return true;
     }
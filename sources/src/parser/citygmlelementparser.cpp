@@ -31,7 +31,7 @@ namespace citygml {
         }
     }
 
-    bool CityGMLElementParser::endElement(const NodeType::XMLNode& node, const std::string& characters)
+    bool CityGMLElementParser::endElement(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (!m_boundElement.valid()) {
             // This might happen if an container element that usally contains a child element links to an exting object using XLink an thus
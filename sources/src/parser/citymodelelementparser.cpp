@@ -1,5 +1,7 @@
 #include "parser/citymodelelementparser.h"
 
+#include "parser/citygmldocumentparser.h"
+
 #include "parser/nodetypes.h"
 #include "parser/attributes.h"
 #include "parser/documentlocation.h"
@@ -39,11 +41,11 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createCityModel(attributes.getCityGMLIDAttribute());
+        m_model = m_factory.createCityModel(getObjectID(attributes));
         return true;
     }
 
-    bool CityModelElementParser::parseElementEndTag(const NodeType::XMLNode& node, const std::string&)
+    bool CityModelElementParser::parseElementEndTag(const NodeType::XMLNode& node, const CharacterData&)
     {
         if (node != NodeType::CORE_CityModelNode) {
             CITYGML_LOG_WARN(m_logger, "Expected end tag <" << NodeType::CORE_CityModelNode.name() << "> got <" << node.name() << "> at " << getDocumentLocation());
@@ -60,36 +62,35 @@ namespace citygml {
             throw std::runtime_error("CityModelElementParser::parseChildElementStartTag called before CityModelElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::CORE_CityObjectMemberNode) {
+        switch (node.typeID()) {
+        case NodeType::CORE_CityObjectMemberTypeID:
             setParserForNextElement(new CityObjectElementParser(m_documentParser, m_factory, m_logger, [this](CityObject* obj) {
-                                        this->m_model->addRootObject(obj);
+                                        m_documentParser.addRootCityObject(*this->m_model, obj);
                                     }));
             return true;
-        } else if (node == NodeType::APP_AppearanceNode // Compatibility with CityGML 1.0 (in CityGML 2 CityObjects can only contain appearanceMember elements)
-                   || node == NodeType::APP_AppearanceMemberNode) {
-
+        case NodeType::APP_AppearanceTypeID: // Compatibility with CityGML 1.0 (in CityGML 2 CityObjects can only contain appearanceMember elements)
+        case NodeType::APP_AppearanceMemberTypeID:
             setParserForNextElement(new AppearanceElementParser(m_documentParser, m_factory, m_logger));
             return true;
-        } else {
+        default:
             return GMLFeatureCollectionElementParser::parseChildElementStartTag(node, attributes);
         }
-        return false;
     }
 
-    bool CityModelElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool CityModelElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (m_model == nullptr) {
             throw std::runtime_error("CityModelElementParser::parseChildElementEndTag called before CityModelElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::CORE_CityObjectMemberNode
-         || node == NodeType::APP_AppearanceNode
-         || node == NodeType::APP_AppearanceMemberNode) {
+        switch (node.typeID()) {
+        case NodeType::CORE_CityObjectMemberTypeID:
+        case NodeType::APP_AppearanceTypeID:
+        case NodeType::APP_AppearanceMemberTypeID:
             return true;
-        } else {
+        default:
             return GMLFeatureCollectionElementParser::parseChildElementEndTag(node, characters);
         }
-        return false;
     }
 
     FeatureObject* CityModelElementParser::getFeatureObject()
@@ -1,6 +1,7 @@
 #include "parser/cityobjectelementparser.h"
 #include "parser/nodetypes.h"
 #include "parser/attributes.h"
+#include "parser/characterdata.h"
 #include "parser/documentlocation.h"
 #include "parser/appearanceelementparser.h"
 #include "parser/geometryelementparser.h"
@@ -10,6 +11,7 @@
 #include "parser/delayedchoiceelementparser.h"
 #include "parser/linestringelementparser.h"
 #include "parser/addressparser.h"
+#include "parser/citygmldocumentparser.h"
 
 #include <citygml/citygmlfactory.h>
 #include <citygml/citygmllogger.h>
@@ -20,19 +22,9 @@
 
 namespace citygml {
 
-    bool CityObjectElementParser::typeIDTypeMapInitialized = false;
-    bool CityObjectElementParser::attributesSetInitialized = false;
-
-    std::unordered_map<int, CityObject::CityObjectsType> CityObjectElementParser::typeIDTypeMap = std::unordered_map<int, CityObject::CityObjectsType>();
-    std::unordered_set<int> CityObjectElementParser::attributesSet = std::unordered_set<int>();
-    std::unordered_map<int, AttributeType> CityObjectElementParser::attributeTypeMap;
-
-    std::mutex CityObjectElementParser::initializedTypeIDMutex;
-    std::mutex CityObjectElementParser::initializedAttributeSetMutex;
-
-    #define HANDLE_TYPE( prefix, elementName ) std::pair<int, CityObject::CityObjectsType>(NodeType::prefix ## _ ## elementName ## Node.typeID(), CityObject::CityObjectsType::COT_## elementName)
-    #define HANDLE_GROUP_TYPE( prefix, elementName, enumtype ) std::pair<int, CityObject::CityObjectsType>(NodeType::prefix ## _ ## elementName ## Node.typeID(), enumtype)
-    #define HANDLE_ATTR( prefix, elementName ) NodeType::prefix ## _ ## elementName ## Node.typeID()
+    #define HANDLE_TYPE( prefix, elementName ) case NodeType::prefix ## _ ## elementName ## TypeID: type = CityObject::CityObjectsType::COT_## elementName; return true;
+    #define HANDLE_GROUP_TYPE( prefix, elementName, enumtype ) case NodeType::prefix ## _ ## elementName ## TypeID: type = enumtype; return true;
+    #define HANDLE_ATTR( prefix, elementName, attributeType ) case NodeType::prefix ## _ ## elementName ## TypeID: type = attributeType; return true;
 
     CityObjectElementParser::CityObjectElementParser(CityGMLDocumentParser& documentParser, CityGMLFactory& factory, std::shared_ptr<CityGMLLogger> logger, std::function<void (CityObject*)> callback)
         : GMLFeatureCollectionElementParser(documentParser, factory, logger)
@@ -46,167 +38,116 @@ namespace citygml {
         return "CityObjectElementParser";
     }
 
-    void CityObjectElementParser::initializeTypeIDTypeMap()
+    bool CityObjectElementParser::getCityObjectsType(const NodeType::XMLNode& node, CityObject::CityObjectsType& type)
     {
-        // double-checked lock
-        if (!typeIDTypeMapInitialized) {
-            std::lock_guard<std::mutex> lock(CityObjectElementParser::initializedTypeIDMutex);
-
-            if (!typeIDTypeMapInitialized) {
-                typeIDTypeMap.insert(HANDLE_TYPE(GEN, GenericCityObject));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, Building));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, BuildingPart));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, Room));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, BuildingInstallation));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, BuildingFurniture));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, Door));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, Window));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, CityFurniture));
-                typeIDTypeMap.insert(HANDLE_TYPE(FRN, CityFurniture));
-                typeIDTypeMap.insert(HANDLE_TYPE(TRANS, Track));
-                typeIDTypeMap.insert(HANDLE_TYPE(TRANS, Road));
-                typeIDTypeMap.insert(HANDLE_TYPE(TRANS, Railway));
-                typeIDTypeMap.insert(HANDLE_TYPE(TRANS, Square));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(TRANS, TransportationComplex, CityObject::CityObjectsType::COT_TransportationObject));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(TRANS, TrafficArea, CityObject::CityObjectsType::COT_TransportationObject));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(TRANS, AuxiliaryTrafficArea, CityObject::CityObjectsType::COT_TransportationObject));
-                typeIDTypeMap.insert(HANDLE_TYPE(VEG, PlantCover));
-                typeIDTypeMap.insert(HANDLE_TYPE(VEG, SolitaryVegetationObject));
-                typeIDTypeMap.insert(HANDLE_TYPE(WTR, WaterBody));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(WTR, WaterSurface, CityObject::CityObjectsType::COT_WaterBody));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(WTR, WaterGroundSurface, CityObject::CityObjectsType::COT_WaterBody));
-                typeIDTypeMap.insert(HANDLE_GROUP_TYPE(WTR, WaterClosureSurface, CityObject::CityObjectsType::COT_WaterBody));
-                typeIDTypeMap.insert(HANDLE_TYPE(LUSE, LandUse));
-                typeIDTypeMap.insert(HANDLE_TYPE(SUB, Tunnel));
-                typeIDTypeMap.insert(HANDLE_TYPE(BRID, Bridge));
-                typeIDTypeMap.insert(HANDLE_TYPE(BRID, BridgeConstructionElement));
-                typeIDTypeMap.insert(HANDLE_TYPE(BRID, BridgeInstallation));
-                typeIDTypeMap.insert(HANDLE_TYPE(BRID, BridgePart));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, WallSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, RoofSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, GroundSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, ClosureSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, FloorSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, InteriorWallSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, CeilingSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, OuterCeilingSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(BLDG, OuterFloorSurface));
-                typeIDTypeMap.insert(HANDLE_TYPE(GRP, CityObjectGroup));
-                typeIDTypeMap.insert(HANDLE_TYPE(DEM, ReliefFeature));
-
-                typeIDTypeMapInitialized = true;
-            }
+        switch (node.typeID()) {
+        HANDLE_TYPE(GEN, GenericCityObject)
+        HANDLE_TYPE(BLDG, Building)
+        HANDLE_TYPE(BLDG, BuildingPart)
+        HANDLE_TYPE(BLDG, Room)
+        HANDLE_TYPE(BLDG, BuildingInstallation)
+        HANDLE_TYPE(BLDG, BuildingFurniture)
+        HANDLE_TYPE(BLDG, Door)
+        HANDLE_TYPE(BLDG, Window)
+        HANDLE_TYPE(BLDG, CityFurniture)
+        HANDLE_TYPE(FRN, CityFurniture)
+        HANDLE_TYPE(TRANS, Track)
+        HANDLE_TYPE(TRANS, Road)
+        HANDLE_TYPE(TRANS, Railway)
+        HANDLE_TYPE(TRANS, Square)
+        HANDLE_GROUP_TYPE(TRANS, TransportationComplex, CityObject::CityObjectsType::COT_TransportationObject)
+        HANDLE_GROUP_TYPE(TRANS, TrafficArea, CityObject::CityObjectsType::COT_TransportationObject)
+        HANDLE_GROUP_TYPE(TRANS, AuxiliaryTrafficArea, CityObject::CityObjectsType::COT_TransportationObject)
+        HANDLE_TYPE(VEG, PlantCover)
+        HANDLE_TYPE(VEG, SolitaryVegetationObject)
+        HANDLE_TYPE(WTR, WaterBody)
+        HANDLE_GROUP_TYPE(WTR, WaterSurface, CityObject::CityObjectsType::COT_WaterBody)
+        HANDLE_GROUP_TYPE(WTR, WaterGroundSurface, CityObject::CityObjectsType::COT_WaterBody)
+        HANDLE_GROUP_TYPE(WTR, WaterClosureSurface, CityObject::CityObjectsType::COT_WaterBody)
+        HANDLE_TYPE(LUSE, LandUse)
+        HANDLE_TYPE(SUB, Tunnel)
+        HANDLE_TYPE(BRID, Bridge)
+        HANDLE_TYPE(BRID, BridgeConstructionElement)
+        HANDLE_TYPE(BRID, BridgeInstallation)
+        HANDLE_TYPE(BRID, BridgePart)
+        HANDLE_TYPE(BLDG, WallSurface)
+        HANDLE_TYPE(BLDG, RoofSurface)
+        HANDLE_TYPE(BLDG, GroundSurface)
+        HANDLE_TYPE(BLDG, ClosureSurface)
+        HANDLE_TYPE(BLDG, FloorSurface)
+        HANDLE_TYPE(BLDG, InteriorWallSurface)
+        HANDLE_TYPE(BLDG, CeilingSurface)
+        HANDLE_TYPE(BLDG, OuterCeilingSurface)
+        HANDLE_TYPE(BLDG, OuterFloorSurface)
+        HANDLE_TYPE(GRP, CityObjectGroup)
+        HANDLE_TYPE(DEM, ReliefFeature)
+        default:
+            return false;
         }
     }
 
-    void CityObjectElementParser::initializeAttributesSet()
+    bool CityObjectElementParser::getAttributeTypeOfAttributeNode(const NodeType::XMLNode& node, AttributeType& type)
     {
-        // double-checked lock
-        if (!attributesSetInitialized) {
-            std::lock_guard<std::mutex> lock(CityObjectElementParser::initializedAttributeSetMutex);
-
-            if (!attributesSetInitialized) {
-                attributesSet.insert(HANDLE_ATTR(CORE, CreationDate));
-                attributesSet.insert(HANDLE_ATTR(CORE, TerminationDate));
-                attributesSet.insert(HANDLE_ATTR(BLDG, Type));
-                attributesSet.insert(HANDLE_ATTR(BLDG, Class));
-                attributesSet.insert(HANDLE_ATTR(BLDG, Function));
-                attributesSet.insert(HANDLE_ATTR(BLDG, Usage));
-                attributesSet.insert(HANDLE_ATTR(BLDG, YearOfConstruction));
-                attributesSet.insert(HANDLE_ATTR(BLDG, YearOfDemolition));
-                attributesSet.insert(HANDLE_ATTR(BLDG, StoreyHeightsAboveGround));
-                attributesSet.insert(HANDLE_ATTR(BLDG, StoreyHeightsBelowGround));
-                attributesSet.insert(HANDLE_ATTR(BLDG, StoreysBelowGround));
-                attributesSet.insert(HANDLE_ATTR(BLDG, StoreysAboveGround));
-                attributesSet.insert(HANDLE_ATTR(BLDG, MeasuredHeight));
-                attributesSet.insert(HANDLE_ATTR(BLDG, RoofType));
-                attributesSet.insert(HANDLE_ATTR(VEG, Class ));
-                attributesSet.insert(HANDLE_ATTR(VEG, Function ));
-                attributesSet.insert(HANDLE_ATTR(VEG, AverageHeight ));
-                attributesSet.insert(HANDLE_ATTR(VEG, Species ));
-                attributesSet.insert(HANDLE_ATTR(VEG, Height ));
-                attributesSet.insert(HANDLE_ATTR(VEG, TrunkDiameter ));
-                attributesSet.insert(HANDLE_ATTR(VEG, CrownDiameter ));
-                attributesSet.insert(HANDLE_ATTR(FRN, Class));
-                attributesSet.insert(HANDLE_ATTR(FRN, Function));
-                attributesSet.insert(HANDLE_ATTR(GRP, Class));
-                attributesSet.insert(HANDLE_ATTR(GRP, Function));
-                attributesSet.insert(HANDLE_ATTR(GRP, Usage));
-                attributesSet.insert(HANDLE_ATTR(GEN, Class));
-                attributesSet.insert(HANDLE_ATTR(GEN, Function));
-                attributesSet.insert(HANDLE_ATTR(GEN, Usage));
-                attributesSet.insert(HANDLE_ATTR(LUSE, Class));
-                attributesSet.insert(HANDLE_ATTR(LUSE, Function));
-                attributesSet.insert(HANDLE_ATTR(LUSE, Usage));
-                attributesSet.insert(HANDLE_ATTR(DEM, Lod));
-                attributesSet.insert(HANDLE_ATTR(TRANS, Usage));
-                attributesSet.insert(HANDLE_ATTR(TRANS, Function));
-                attributesSet.insert(HANDLE_ATTR(TRANS, SurfaceMaterial));
-                attributesSet.insert(HANDLE_ATTR(WTR, Class));
-                attributesSet.insert(HANDLE_ATTR(WTR, Function));
-                attributesSet.insert(HANDLE_ATTR(WTR, Usage));
-                attributesSet.insert(HANDLE_ATTR(WTR, WaterLevel));
-
-
-                attributeTypeMap[HANDLE_ATTR(CORE, CreationDate)] = AttributeType::Date;
-                attributeTypeMap[HANDLE_ATTR(CORE, TerminationDate)] = AttributeType::Date;
-                attributeTypeMap[HANDLE_ATTR(BLDG, Type)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(BLDG, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(BLDG, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(BLDG, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(BLDG, YearOfConstruction)] = AttributeType::Date;
-                attributeTypeMap[HANDLE_ATTR(BLDG, YearOfDemolition)] = AttributeType::Date;
-                attributeTypeMap[HANDLE_ATTR(BLDG, StoreyHeightsAboveGround)] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(BLDG, StoreyHeightsBelowGround)] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(BLDG, StoreysBelowGround)] = AttributeType::Integer;
-                attributeTypeMap[HANDLE_ATTR(BLDG, StoreysAboveGround)] = AttributeType::Integer;
-                attributeTypeMap[HANDLE_ATTR(BLDG, MeasuredHeight)] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(BLDG, RoofType)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(VEG, Class )] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(VEG, Function )] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(VEG, AverageHeight )] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(VEG, Species )] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(VEG, Height )] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(VEG, TrunkDiameter )] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(VEG, CrownDiameter )] = AttributeType::Double;
-                attributeTypeMap[HANDLE_ATTR(FRN, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(FRN, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GRP, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GRP, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GRP, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GEN, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GEN, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(GEN, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(LUSE, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(LUSE, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(LUSE, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(DEM, Lod)] = AttributeType::Integer;
-                attributeTypeMap[HANDLE_ATTR(TRANS, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(TRANS, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(TRANS, SurfaceMaterial)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(WTR, Class)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(WTR, Function)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(WTR, Usage)] = AttributeType::String;
-                attributeTypeMap[HANDLE_ATTR(WTR, WaterLevel)] = AttributeType::Double;
-
-                attributesSetInitialized = true;
-            }
+        switch (node.typeID()) {
+        HANDLE_ATTR(CORE, CreationDate, AttributeType::Date)
+        HANDLE_ATTR(CORE, TerminationDate, AttributeType::Date)
+        HANDLE_ATTR(BLDG, Type, AttributeType::String)
+        HANDLE_ATTR(BLDG, Class, AttributeType::String)
+        HANDLE_ATTR(BLDG, Function, AttributeType::String)
+        HANDLE_ATTR(BLDG, Usage, AttributeType::String)
+        HANDLE_ATTR(BLDG, YearOfConstruction, AttributeType::Date)
+        HANDLE_ATTR(BLDG, YearOfDemolition, AttributeType::Date)
+        HANDLE_ATTR(BLDG, StoreyHeightsAboveGround, AttributeType::Double)
+        HANDLE_ATTR(BLDG, StoreyHeightsBelowGround, AttributeType::Double)
+        HANDLE_ATTR(BLDG, StoreysBelowGround, AttributeType::Integer)
+        HANDLE_ATTR(BLDG, StoreysAboveGround, AttributeType::Integer)
+        HANDLE_ATTR(BLDG, MeasuredHeight, AttributeType::Double)
+        HANDLE_ATTR(BLDG, RoofType, AttributeType::String)
+        HANDLE_ATTR(VEG, Class, AttributeType::String)
+        HANDLE_ATTR(VEG, Function, AttributeType::String)
+        HANDLE_ATTR(VEG, AverageHeight, AttributeType::Double)
+        HANDLE_ATTR(VEG, Species, AttributeType::String)
+        HANDLE_ATTR(VEG, Height, AttributeType::Double)
+        HANDLE_ATTR(VEG, TrunkDiameter, AttributeType::Double)
+        HANDLE_ATTR(VEG, CrownDiameter, AttributeType::Double)
+        HANDLE_ATTR(FRN, Class, AttributeType::String)
+        HANDLE_ATTR(FRN, Function, AttributeType::String)
+        HANDLE_ATTR(GRP, Class, AttributeType::String)
+        HANDLE_ATTR(GRP, Function, AttributeType::String)
+        HANDLE_ATTR(GRP, Usage, AttributeType::String)
+        HANDLE_ATTR(GEN, Class, AttributeType::String)
+        HANDLE_ATTR(GEN, Function, AttributeType::String)
+        HANDLE_ATTR(GEN, Usage, AttributeType::String)
+        HANDLE_ATTR(LUSE, Class, AttributeType::String)
+        HANDLE_ATTR(LUSE, Function, AttributeType::String)
+        HANDLE_ATTR(LUSE, Usage, AttributeType::String)
+        HANDLE_ATTR(DEM, Lod, AttributeType::Integer)
+        HANDLE_ATTR(TRANS, Usage, AttributeType::String)
+        HANDLE_ATTR(TRANS, Function, AttributeType::String)
+        HANDLE_ATTR(TRANS, SurfaceMaterial, AttributeType::String)
+        HANDLE_ATTR(WTR, Class, AttributeType::String)
+        HANDLE_ATTR(WTR, Function, AttributeType::String)
+        HANDLE_ATTR(WTR, Usage, AttributeType::String)
+        HANDLE_ATTR(WTR, WaterLevel, AttributeType::Double)
+        default:
+            return false;
         }
     }
 
     AttributeType CityObjectElementParser::getAttributeType(const NodeType::XMLNode& node)
     {
-        if (node == NodeType::GEN_StringAttributeNode) {
+        switch (node.typeID()) {
+        case NodeType::GEN_StringAttributeTypeID:
             return AttributeType::String;
-        } else if (node == NodeType::GEN_DoubleAttributeNode) {
+        case NodeType::GEN_DoubleAttributeTypeID:
             return AttributeType::Double;
-        } else if (node == NodeType::GEN_IntAttributeNode) {
+        case NodeType::GEN_IntAttributeTypeID:
             return AttributeType::Integer;
-        } else if (node == NodeType::GEN_DateAttributeNode) {
+        case NodeType::GEN_DateAttributeTypeID:
             return AttributeType::Date;
-        } else if (node == NodeType::GEN_UriAttributeNode) {
+        case NodeType::GEN_UriAttributeTypeID:
             return AttributeType::Uri;
-        } else {
+        default:
             // fallback to string for other types
             return AttributeType::String;
         }
@@ -214,28 +155,34 @@ namespace citygml {
 
     bool CityObjectElementParser::handlesElement(const NodeType::XMLNode& node) const
     {
-        initializeTypeIDTypeMap();
-
-        return typeIDTypeMap.count(node.typeID()) > 0;
+        CityObject::CityObjectsType type;
+        return getCityObjectsType(node, type);
     }
 
     bool CityObjectElementParser::parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
     {
-        initializeTypeIDTypeMap();
-
-        auto it = typeIDTypeMap.find(node.typeID());
-
-        if (it == typeIDTypeMap.end()) {
+        CityObject::CityObjectsType type;
+        if (!getCityObjectsType(node, type)) {
             CITYGML_LOG_ERROR(m_logger, "Expected start tag of CityObject but got <" << node.name() << "> at " << getDocumentLocation());
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createCityObject(attributes.getCityGMLIDAttribute(), static_cast<CityObject::CityObjectsType>(it->second));
+        const CityObject::CityObjectsType objectsMask = m_documentParser.getParserParams().objectsMask;
+        if ((objectsMask & type) != type) {
+            // The object is filtered out by the objects mask... replace this parser by a SkipElementParser that is bound to the
+            // element so that none of its children (geometries, polygons, child CityObjects...) are ever created
+            CITYGML_LOG_DEBUG(m_logger, "Skipping CityObject <" << node << "> at " << getDocumentLocation() << " (filtered by objects mask)");
+            m_documentParser.removeCurrentElementParser(this);
+            m_documentParser.setCurrentElementParser(new SkipElementParser(m_documentParser, m_logger, node));
+            return true;
+        }
+
+        m_model = m_factory.createCityObject(getObjectID(attributes), type);
         return true;
 
     }
 
-    bool CityObjectElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool CityObjectElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         m_model = nullptr;
@@ -244,285 +191,291 @@ namespace citygml {
 
     bool CityObjectElementParser::parseChildElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
     {
-        initializeAttributesSet();
-
         if (m_model == nullptr) {
             throw std::runtime_error("CityObjectElementParser::parseChildElementStartTag called before CityObjectElementParser::parseElementStartTag");
         }
 
-        if (    node == NodeType::GEN_StringAttributeNode
-             || node == NodeType::GEN_DoubleAttributeNode
-             || node == NodeType::GEN_IntAttributeNode
-             || node == NodeType::GEN_DateAttributeNode
-             || node == NodeType::GEN_UriAttributeNode) {
-
-            m_lastAttributeName = attributes.getAttribute("name");
+        switch (node.typeID()) {
+        case NodeType::GEN_StringAttributeTypeID:
+        case NodeType::GEN_DoubleAttributeTypeID:
+        case NodeType::GEN_IntAttributeTypeID:
+        case NodeType::GEN_DateAttributeTypeID:
+        case NodeType::GEN_UriAttributeTypeID:
+            m_lastAttributeName = attributes.getAttribute(AttributeName::Name);
             m_lastAttributeType = getAttributeType(node);
-        } else if (attributesSet.count(node.typeID()) > 0 || node == NodeType::GEN_ValueNode) {
-
             return true;
-        } else if (node == NodeType::BLDG_BoundedByNode
-                   || node == NodeType::BLDG_OuterBuildingInstallationNode
-                   || node == NodeType::BLDG_InteriorBuildingInstallationNode
-                   || node == NodeType::BLDG_InteriorFurnitureNode
-                   || node == NodeType::BLDG_RoomInstallationNode
-                   || node == NodeType::BLDG_InteriorRoomNode
-                   || node == NodeType::BLDG_OpeningNode
-                   || node == NodeType::BLDG_ConsistsOfBuildingPartNode
-                   || node == NodeType::GRP_GroupMemberNode
-                   || node == NodeType::GRP_ParentNode
-                   || node == NodeType::TRANS_TrafficAreaNode
-                   || node == NodeType::TRANS_AuxiliaryTrafficAreaNode
-                   || node == NodeType::WTR_BoundedByNode) {
+        case NodeType::GEN_ValueTypeID:
+            return true;
+        case NodeType::BLDG_BoundedByTypeID:
+        case NodeType::BLDG_OuterBuildingInstallationTypeID:
+        case NodeType::BLDG_InteriorBuildingInstallationTypeID:
+        case NodeType::BLDG_InteriorFurnitureTypeID:
+        case NodeType::BLDG_RoomInstallationTypeID:
+        case NodeType::BLDG_InteriorRoomTypeID:
+        case NodeType::BLDG_OpeningTypeID:
+        case NodeType::BLDG_ConsistsOfBuildingPartTypeID:
+        case NodeType::GRP_GroupMemberTypeID:
+        case NodeType::GRP_ParentTypeID:
+        case NodeType::TRANS_TrafficAreaTypeID:
+        case NodeType::TRANS_AuxiliaryTrafficAreaTypeID:
+        case NodeType::WTR_BoundedByTypeID:
             setParserForNextElement(new CityObjectElementParser(m_documentParser, m_factory, m_logger, [this](CityObject* obj) {
                                         m_model->addChildCityObject(obj);
                                     }));
-        } else if (node == NodeType::APP_AppearanceNode // Compatibility with CityGML 1.0 (in CityGML 2 CityObjects can only contain appearanceMember elements)
-                   || node == NodeType::APP_AppearanceMemberNode) {
-
+            return true;
+        case NodeType::APP_AppearanceTypeID: // Compatibility with CityGML 1.0 (in CityGML 2 CityObjects can only contain appearanceMember elements)
+        case NodeType::APP_AppearanceMemberTypeID:
             setParserForNextElement(new AppearanceElementParser(m_documentParser, m_factory, m_logger));
-        } else if (node == NodeType::BLDG_Lod1MultiCurveNode
-                   || node == NodeType::BLDG_Lod1MultiSurfaceNode
-                   || node == NodeType::BLDG_Lod1SolidNode
-                   || node == NodeType::BLDG_Lod1TerrainIntersectionNode
-                   || node == NodeType::GEN_Lod1TerrainIntersectionNode
-                   || node == NodeType::FRN_Lod1TerrainIntersectionNode
-                   || node == NodeType::LUSE_Lod1MultiSurfaceNode
-                   || node == NodeType::TRANS_Lod1MultiSurfaceNode
-                   || node == NodeType::WTR_Lod1MultiCurveNode
-                   || node == NodeType::WTR_Lod1MultiSurfaceNode
-                   || node == NodeType::WTR_Lod1SolidNode) {
-
-            parseGeometryForLODLevel(1);
-        } else if (node == NodeType::BLDG_Lod2MultiCurveNode
-                   || node == NodeType::BLDG_Lod2MultiSurfaceNode
-                   || node == NodeType::BLDG_Lod2SolidNode
-                   || node == NodeType::BLDG_Lod2TerrainIntersectionNode
-                   || node == NodeType::GEN_Lod2TerrainIntersectionNode
-                   || node == NodeType::FRN_Lod2TerrainIntersectionNode
-                   || node == NodeType::LUSE_Lod2MultiSurfaceNode
-                   || node == NodeType::TRANS_Lod2MultiSurfaceNode
-                   || node == NodeType::WTR_Lod2SolidNode
-                   || node == NodeType::WTR_Lod2SurfaceNode) {
-
-            parseGeometryForLODLevel(2);
-        } else if (node == NodeType::BLDG_Lod3MultiCurveNode
-                   || node == NodeType::BLDG_Lod3MultiSurfaceNode
-                   || node == NodeType::BLDG_Lod3SolidNode
-                   || node == NodeType::BLDG_Lod3TerrainIntersectionNode
-                   || node == NodeType::GEN_Lod3TerrainIntersectionNode
-                   || node == NodeType::FRN_Lod3TerrainIntersectionNode
-                   || node == NodeType::LUSE_Lod3MultiSurfaceNode
-                   || node == NodeType::TRANS_Lod3MultiSurfaceNode
-                   || node == NodeType::WTR_Lod3SolidNode
-                   || node == NodeType::WTR_Lod3SurfaceNode) {
-
-            parseGeometryForLODLevel(3);
-        } else if (node == NodeType::BLDG_Lod4MultiCurveNode
-                   || node == NodeType::BLDG_Lod4MultiSurfaceNode
-                   || node == NodeType::BLDG_Lod4SolidNode
-                   || node == NodeType::BLDG_Lod4TerrainIntersectionNode
-                   || node == NodeType::GEN_Lod4TerrainIntersectionNode
-                   || node == NodeType::FRN_Lod4TerrainIntersectionNode
-                   || node == NodeType::LUSE_Lod4MultiSurfaceNode
-                   || node == NodeType::TRANS_Lod4MultiSurfaceNode
-                   || node == NodeType::WTR_Lod4SolidNode
-                   || node == NodeType::WTR_Lod4SurfaceNode) {
-
-            parseGeometryForLODLevel(4);
-        } else if (node == NodeType::GEN_Lod1GeometryNode
-                   || node == NodeType::FRN_Lod1GeometryNode
-                   || node == NodeType::VEG_Lod1GeometryNode) {
-            parseGeometryPropertyElementForLODLevel(1, attributes.getCityGMLIDAttribute());
-        } else if (node == NodeType::GEN_Lod2GeometryNode
-                   || node == NodeType::FRN_Lod2GeometryNode
-                   || node == NodeType::BLDG_Lod2GeometryNode
-                   || node == NodeType::VEG_Lod2GeometryNode) {
-            parseGeometryPropertyElementForLODLevel(2, attributes.getCityGMLIDAttribute());
-        } else if (node == NodeType::GEN_Lod3GeometryNode
-                   || node == NodeType::FRN_Lod3GeometryNode
-                   || node == NodeType::BLDG_Lod3GeometryNode
-                   || node == NodeType::VEG_Lod3GeometryNode) {
-            parseGeometryPropertyElementForLODLevel(3, attributes.getCityGMLIDAttribute());
-        } else if (node == NodeType::GEN_Lod4GeometryNode
-                   || node == NodeType::FRN_Lod4GeometryNode
-                   || node == NodeType::BLDG_Lod4GeometryNode
-                   || node == NodeType::VEG_Lod4GeometryNode) {
-            parseGeometryPropertyElementForLODLevel(4, attributes.getCityGMLIDAttribute());
-        } else if (node == NodeType::VEG_Lod1ImplicitRepresentationNode
-                   || node == NodeType::FRN_Lod1ImplicitRepresentationNode
-                   || node == NodeType::GEN_Lod1ImplicitRepresentationNode) {
-
-            parseImplicitGeometryForLODLevel(1);
-        } else if (node == NodeType::VEG_Lod2ImplicitRepresentationNode
-                   || node == NodeType::FRN_Lod2ImplicitRepresentationNode
-                   || node == NodeType::GEN_Lod2ImplicitRepresentationNode) {
-
-            parseImplicitGeometryForLODLevel(2);
-        } else if (node == NodeType::VEG_Lod3ImplicitRepresentationNode
-                   || node == NodeType::FRN_Lod3ImplicitRepresentationNode
-                   || node == NodeType::GEN_Lod3ImplicitRepresentationNode) {
-
-            parseImplicitGeometryForLODLevel(3);
-        } else if (node == NodeType::VEG_Lod4ImplicitRepresentationNode
-                   || node == NodeType::FRN_Lod4ImplicitRepresentationNode
-                   || node == NodeType::GEN_Lod4ImplicitRepresentationNode) {
-
-            parseImplicitGeometryForLODLevel(4);
-        } else if (node == NodeType::CORE_GeneralizesToNode
-                   || node == NodeType::CORE_ExternalReferenceNode
-                   || node == NodeType::GML_MultiPointNode
-                   || node == NodeType::GRP_GeometryNode
-                   || node == NodeType::DEM_ReliefComponentNode
-                   || node == NodeType::GEN_Lod0GeometryNode
-                   || node == NodeType::GEN_Lod0ImplicitRepresentationNode
-                   || node == NodeType::GEN_Lod0TerrainIntersectionNode
-                   || node == NodeType::TRANS_Lod0NetworkNode
-                   || node == NodeType::WTR_Lod0MultiCurveNode
-                   || node == NodeType::WTR_Lod0MultiSurfaceNode) {
+            return true;
+        case NodeType::BLDG_Lod1MultiCurveTypeID:
+        case NodeType::BLDG_Lod1MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod1SolidTypeID:
+        case NodeType::BLDG_Lod1TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod1TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod1TerrainIntersectionTypeID:
+        case NodeType::LUSE_Lod1MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod1MultiSurfaceTypeID:
+        case NodeType::WTR_Lod1MultiCurveTypeID:
+        case NodeType::WTR_Lod1MultiSurfaceTypeID:
+        case NodeType::WTR_Lod1SolidTypeID:
+            parseGeometryForLODLevel(1, node);
+            return true;
+        case NodeType::BLDG_Lod2MultiCurveTypeID:
+        case NodeType::BLDG_Lod2MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod2SolidTypeID:
+        case NodeType::BLDG_Lod2TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod2TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod2TerrainIntersectionTypeID:
+        case NodeType::LUSE_Lod2MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod2MultiSurfaceTypeID:
+        case NodeType::WTR_Lod2SolidTypeID:
+        case NodeType::WTR_Lod2SurfaceTypeID:
+            parseGeometryForLODLevel(2, node);
+            return true;
+        case NodeType::BLDG_Lod3MultiCurveTypeID:
+        case NodeType::BLDG_Lod3MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod3SolidTypeID:
+        case NodeType::BLDG_Lod3TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod3TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod3TerrainIntersectionTypeID:
+        case NodeType::LUSE_Lod3MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod3MultiSurfaceTypeID:
+        case NodeType::WTR_Lod3SolidTypeID:
+        case NodeType::WTR_Lod3SurfaceTypeID:
+            parseGeometryForLODLevel(3, node);
+            return true;
+        case NodeType::BLDG_Lod4MultiCurveTypeID:
+        case NodeType::BLDG_Lod4MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod4SolidTypeID:
+        case NodeType::BLDG_Lod4TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod4TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod4TerrainIntersectionTypeID:
+        case NodeType::LUSE_Lod4MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod4MultiSurfaceTypeID:
+        case NodeType::WTR_Lod4SolidTypeID:
+        case NodeType::WTR_Lod4SurfaceTypeID:
+            parseGeometryForLODLevel(4, node);
+            return true;
+        case NodeType::GEN_Lod1GeometryTypeID:
+        case NodeType::FRN_Lod1GeometryTypeID:
+        case NodeType::VEG_Lod1GeometryTypeID:
+            parseGeometryPropertyElementForLODLevel(1, node, attributes);
+            return true;
+        case NodeType::GEN_Lod2GeometryTypeID:
+        case NodeType::FRN_Lod2GeometryTypeID:
+        case NodeType::BLDG_Lod2GeometryTypeID:
+        case NodeType::VEG_Lod2GeometryTypeID:
+            parseGeometryPropertyElementForLODLevel(2, node, attributes);
+            return true;
+        case NodeType::GEN_Lod3GeometryTypeID:
+        case NodeType::FRN_Lod3GeometryTypeID:
+        case NodeType::BLDG_Lod3GeometryTypeID:
+        case NodeType::VEG_Lod3GeometryTypeID:
+            parseGeometryPropertyElementForLODLevel(3, node, attributes);
+            return true;
+        case NodeType::GEN_Lod4GeometryTypeID:
+        case NodeType::FRN_Lod4GeometryTypeID:
+        case NodeType::BLDG_Lod4GeometryTypeID:
+        case NodeType::VEG_Lod4GeometryTypeID:
+            parseGeometryPropertyElementForLODLevel(4, node, attributes);
+            return true;
+        case NodeType::VEG_Lod1ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod1ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod1ImplicitRepresentationTypeID:
+            parseImplicitGeometryForLODLevel(1, node);
+            return true;
+        case NodeType::VEG_Lod2ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod2ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod2ImplicitRepresentationTypeID:
+            parseImplicitGeometryForLODLevel(2, node);
+            return true;
+        case NodeType::VEG_Lod3ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod3ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod3ImplicitRepresentationTypeID:
+            parseImplicitGeometryForLODLevel(3, node);
+            return true;
+        case NodeType::VEG_Lod4ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod4ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod4ImplicitRepresentationTypeID:
+            parseImplicitGeometryForLODLevel(4, node);
+            return true;
+        case NodeType::CORE_GeneralizesToTypeID:
+        case NodeType::CORE_ExternalReferenceTypeID:
+        case NodeType::GML_MultiPointTypeID:
+        case NodeType::GRP_GeometryTypeID:
+        case NodeType::DEM_ReliefComponentTypeID:
+        case NodeType::GEN_Lod0GeometryTypeID:
+        case NodeType::GEN_Lod0ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod0TerrainIntersectionTypeID:
+        case NodeType::TRANS_Lod0NetworkTypeID:
+        case NodeType::WTR_Lod0MultiCurveTypeID:
+        case NodeType::WTR_Lod0MultiSurfaceTypeID:
             CITYGML_LOG_INFO(m_logger, "Skipping CityObject child element <" << node  << ">  at " << getDocumentLocation() << " (Currently not supported!)");
             setParserForNextElement(new SkipElementParser(m_documentParser, m_logger, node));
             return true;
-        } else if (node == NodeType::BLDG_AddressNode
-                   || node == NodeType::CORE_AddressNode
-                   || node == NodeType::CORE_XalAddressNode) {
+        case NodeType::BLDG_AddressTypeID:
+        case NodeType::CORE_AddressTypeID:
+        case NodeType::CORE_XalAddressTypeID:
             setParserForNextElement(new AddressParser(m_documentParser, m_factory, m_logger, [this](std::unique_ptr<Address>&& address) {
                 m_model->setAddress(std::move(address));
             }));
             return true;
-        } else {
-            return GMLFeatureCollectionElementParser::parseChildElementStartTag(node, attributes);
+        default:
+            break;
         }
 
-        return true;
+        AttributeType type;
+        if (getAttributeTypeOfAttributeNode(node, type)) {
+            return true;
+        }
 
+        return GMLFeatureCollectionElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool CityObjectElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool CityObjectElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (m_model == nullptr) {
             throw std::runtime_error("CityObjectElementParser::parseChildElementEndTag called before CityObjectElementParser::parseElementStartTag");
         }
 
-        initializeAttributesSet();
-
-        if (    node == NodeType::GEN_StringAttributeNode
-             || node == NodeType::GEN_DoubleAttributeNode
-             || node == NodeType::GEN_IntAttributeNode
-             || node == NodeType::GEN_DateAttributeNode
-             || node == NodeType::GEN_UriAttributeNode) {
-
+        switch (node.typeID()) {
+        case NodeType::GEN_StringAttributeTypeID:
+        case NodeType::GEN_DoubleAttributeTypeID:
+        case NodeType::GEN_IntAttributeTypeID:
+        case NodeType::GEN_DateAttributeTypeID:
+        case NodeType::GEN_UriAttributeTypeID:
             m_lastAttributeName = "";
             m_lastAttributeType = AttributeType::String;
-
             return true;
-        } else if (node == NodeType::GEN_ValueNode) {
-
+        case NodeType::GEN_ValueTypeID:
             if (!m_lastAttributeName.empty()) {
                 m_model->setAttribute(m_lastAttributeName, characters, m_lastAttributeType);
             } else {
                 CITYGML_LOG_WARN(m_logger, "Found value node (" << NodeType::GEN_ValueNode << ") outside attribute node... ignore.");
             }
-
             return true;
-        } else if (attributesSet.count(node.typeID()) > 0) {
-            if (!characters.empty()) {
-                m_model->setAttribute(node.name(), characters, attributeTypeMap.at(node.typeID()));
-            }
+        case NodeType::BLDG_BoundedByTypeID:
+        case NodeType::BLDG_OuterBuildingInstallationTypeID:
+        case NodeType::BLDG_InteriorBuildingInstallationTypeID:
+        case NodeType::BLDG_InteriorFurnitureTypeID:
+        case NodeType::BLDG_RoomInstallationTypeID:
+        case NodeType::BLDG_InteriorRoomTypeID:
+        case NodeType::BLDG_OpeningTypeID:
+        case NodeType::APP_AppearanceTypeID:
+        case NodeType::APP_AppearanceMemberTypeID:
+        case NodeType::BLDG_Lod1MultiCurveTypeID:
+        case NodeType::BLDG_Lod1MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod1SolidTypeID:
+        case NodeType::BLDG_Lod1TerrainIntersectionTypeID:
+        case NodeType::BLDG_Lod2GeometryTypeID:
+        case NodeType::BLDG_Lod2MultiCurveTypeID:
+        case NodeType::BLDG_Lod2MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod2SolidTypeID:
+        case NodeType::BLDG_Lod2TerrainIntersectionTypeID:
+        case NodeType::BLDG_Lod3GeometryTypeID:
+        case NodeType::BLDG_Lod3MultiCurveTypeID:
+        case NodeType::BLDG_Lod3MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod3SolidTypeID:
+        case NodeType::BLDG_Lod3TerrainIntersectionTypeID:
+        case NodeType::BLDG_Lod4GeometryTypeID:
+        case NodeType::BLDG_Lod4MultiCurveTypeID:
+        case NodeType::BLDG_Lod4MultiSurfaceTypeID:
+        case NodeType::BLDG_Lod4SolidTypeID:
+        case NodeType::BLDG_Lod4TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod1GeometryTypeID:
+        case NodeType::GEN_Lod2GeometryTypeID:
+        case NodeType::GEN_Lod3GeometryTypeID:
+        case NodeType::GEN_Lod4GeometryTypeID:
+        case NodeType::GEN_Lod1TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod2TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod3TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod4TerrainIntersectionTypeID:
+        case NodeType::GEN_Lod1ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod2ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod3ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod4ImplicitRepresentationTypeID:
+        case NodeType::VEG_Lod1ImplicitRepresentationTypeID:
+        case NodeType::VEG_Lod2ImplicitRepresentationTypeID:
+        case NodeType::VEG_Lod3ImplicitRepresentationTypeID:
+        case NodeType::VEG_Lod4ImplicitRepresentationTypeID:
+        case NodeType::CORE_ExternalReferenceTypeID:
+        case NodeType::BLDG_ConsistsOfBuildingPartTypeID:
+        case NodeType::FRN_Lod1GeometryTypeID:
+        case NodeType::FRN_Lod1TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod1ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod2GeometryTypeID:
+        case NodeType::FRN_Lod2TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod2ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod3GeometryTypeID:
+        case NodeType::FRN_Lod3TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod3ImplicitRepresentationTypeID:
+        case NodeType::FRN_Lod4GeometryTypeID:
+        case NodeType::FRN_Lod4TerrainIntersectionTypeID:
+        case NodeType::FRN_Lod4ImplicitRepresentationTypeID:
+        case NodeType::CORE_GeneralizesToTypeID:
+        case NodeType::GML_MultiPointTypeID:
+        case NodeType::GRP_GroupMemberTypeID:
+        case NodeType::GRP_ParentTypeID:
+        case NodeType::LUSE_Lod1MultiSurfaceTypeID:
+        case NodeType::LUSE_Lod2MultiSurfaceTypeID:
+        case NodeType::LUSE_Lod3MultiSurfaceTypeID:
+        case NodeType::LUSE_Lod4MultiSurfaceTypeID:
+        case NodeType::DEM_ReliefComponentTypeID:
+        case NodeType::GEN_Lod0GeometryTypeID:
+        case NodeType::GEN_Lod0ImplicitRepresentationTypeID:
+        case NodeType::GEN_Lod0TerrainIntersectionTypeID:
+        case NodeType::TRANS_Lod0NetworkTypeID:
+        case NodeType::TRANS_TrafficAreaTypeID:
+        case NodeType::TRANS_AuxiliaryTrafficAreaTypeID:
+        case NodeType::TRANS_Lod1MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod2MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod3MultiSurfaceTypeID:
+        case NodeType::TRANS_Lod4MultiSurfaceTypeID:
+        case NodeType::WTR_Lod0MultiCurveTypeID:
+        case NodeType::WTR_Lod0MultiSurfaceTypeID:
+        case NodeType::WTR_Lod1MultiCurveTypeID:
+        case NodeType::WTR_Lod1MultiSurfaceTypeID:
+        case NodeType::WTR_Lod1SolidTypeID:
+        case NodeType::WTR_Lod2SolidTypeID:
+        case NodeType::WTR_Lod3SolidTypeID:
+        case NodeType::WTR_Lod4SolidTypeID:
+        case NodeType::WTR_Lod2SurfaceTypeID:
+        case NodeType::WTR_Lod3SurfaceTypeID:
+        case NodeType::WTR_Lod4SurfaceTypeID:
+        case NodeType::WTR_BoundedByTypeID:
+        case NodeType::BLDG_AddressTypeID:
+        case NodeType::CORE_AddressTypeID:
+        case NodeType::CORE_XalAddressTypeID:
             return true;
-        } else if (node == NodeType::BLDG_BoundedByNode
-                    || node == NodeType::BLDG_OuterBuildingInstallationNode
-                    || node == NodeType::BLDG_InteriorBuildingInstallationNode
-                    || node == NodeType::BLDG_InteriorFurnitureNode
-                    || node == NodeType::BLDG_RoomInstallationNode
-                    || node == NodeType::BLDG_InteriorRoomNode
-                    || node == NodeType::BLDG_OpeningNode
-                    || node == NodeType::APP_AppearanceNode
-                    || node == NodeType::APP_AppearanceMemberNode
-                    || node == NodeType::BLDG_Lod1MultiCurveNode
-                    || node == NodeType::BLDG_Lod1MultiSurfaceNode
-                    || node == NodeType::BLDG_Lod1SolidNode
-                    || node == NodeType::BLDG_Lod1TerrainIntersectionNode
-                    || node == NodeType::BLDG_Lod2GeometryNode
-                    || node == NodeType::BLDG_Lod2MultiCurveNode
-                    || node == NodeType::BLDG_Lod2MultiSurfaceNode
-                    || node == NodeType::BLDG_Lod2SolidNode
-                    || node == NodeType::BLDG_Lod2TerrainIntersectionNode
-                    || node == NodeType::BLDG_Lod3GeometryNode
-                    || node == NodeType::BLDG_Lod3MultiCurveNode
-                    || node == NodeType::BLDG_Lod3MultiSurfaceNode
-                    || node == NodeType::BLDG_Lod3SolidNode
-                    || node == NodeType::BLDG_Lod3TerrainIntersectionNode
-                    || node == NodeType::BLDG_Lod4GeometryNode
-                    || node == NodeType::BLDG_Lod4MultiCurveNode
-                    || node == NodeType::BLDG_Lod4MultiSurfaceNode
-                    || node == NodeType::BLDG_Lod4SolidNode
-                    || node == NodeType::BLDG_Lod4TerrainIntersectionNode
-                    || node == NodeType::GEN_Lod1GeometryNode
-                    || node == NodeType::GEN_Lod2GeometryNode
-                    || node == NodeType::GEN_Lod3GeometryNode
-                    || node == NodeType::GEN_Lod4GeometryNode
-                    || node == NodeType::GEN_Lod1TerrainIntersectionNode
-                    || node == NodeType::GEN_Lod2TerrainIntersectionNode
-                    || node == NodeType::GEN_Lod3TerrainIntersectionNode
-                    || node == NodeType::GEN_Lod4TerrainIntersectionNode
-                    || node == NodeType::GEN_Lod1ImplicitRepresentationNode
-                    || node == NodeType::GEN_Lod2ImplicitRepresentationNode
-                    || node == NodeType::GEN_Lod3ImplicitRepresentationNode
-                    || node == NodeType::GEN_Lod4ImplicitRepresentationNode
-                    || node == NodeType::VEG_Lod1ImplicitRepresentationNode
-                    || node == NodeType::VEG_Lod2ImplicitRepresentationNode
-                    || node == NodeType::VEG_Lod3ImplicitRepresentationNode
-                    || node == NodeType::VEG_Lod4ImplicitRepresentationNode
-                    || node == NodeType::CORE_ExternalReferenceNode
-                    || node == NodeType::BLDG_ConsistsOfBuildingPartNode
-                    || node == NodeType::FRN_Lod1GeometryNode
-                    || node == NodeType::FRN_Lod1TerrainIntersectionNode
-                    || node == NodeType::FRN_Lod1ImplicitRepresentationNode
-                    || node == NodeType::FRN_Lod2GeometryNode
-                    || node == NodeType::FRN_Lod2TerrainIntersectionNode
-                    || node == NodeType::FRN_Lod2ImplicitRepresentationNode
-                    || node == NodeType::FRN_Lod3GeometryNode
-                    || node == NodeType::FRN_Lod3TerrainIntersectionNode
-                    || node == NodeType::FRN_Lod3ImplicitRepresentationNode
-                    || node == NodeType::FRN_Lod4GeometryNode
-                    || node == NodeType::FRN_Lod4TerrainIntersectionNode
-                    || node == NodeType::FRN_Lod4ImplicitRepresentationNode
-                    || node == NodeType::CORE_GeneralizesToNode
-                    || node == NodeType::GML_MultiPointNode
-                    || node == NodeType::GRP_GroupMemberNode
-                    || node == NodeType::GRP_ParentNode
-                    || node == NodeType::LUSE_Lod1MultiSurfaceNode
-                    || node == NodeType::LUSE_Lod2MultiSurfaceNode
-                    || node == NodeType::LUSE_Lod3MultiSurfaceNode
-                    || node == NodeType::LUSE_Lod4MultiSurfaceNode
-                    || node == NodeType::DEM_ReliefComponentNode
-                    || node == NodeType::GEN_Lod0GeometryNode
-                    || node == NodeType::GEN_Lod0ImplicitRepresentationNode
-                    || node == NodeType::GEN_Lod0TerrainIntersectionNode
-                    || node == NodeType::TRANS_Lod0NetworkNode
-                    || node == NodeType::TRANS_TrafficAreaNode
-                    || node == NodeType::TRANS_AuxiliaryTrafficAreaNode
-                    || node == NodeType::TRANS_Lod1MultiSurfaceNode
-                    || node == NodeType::TRANS_Lod2MultiSurfaceNode
-                    || node == NodeType::TRANS_Lod3MultiSurfaceNode
-                    || node == NodeType::TRANS_Lod4MultiSurfaceNode
-                    || node == NodeType::WTR_Lod0MultiCurveNode
-                    || node == NodeType::WTR_Lod0MultiSurfaceNode
-                    || node == NodeType::WTR_Lod1MultiCurveNode
-                    || node == NodeType::WTR_Lod1MultiSurfaceNode
-                    || node == NodeType::WTR_Lod1SolidNode
-                    || node == NodeType::WTR_Lod2SolidNode
-                    || node == NodeType::WTR_Lod3SolidNode
-                    || node == NodeType::WTR_Lod4SolidNode
-                    || node == NodeType::WTR_Lod2SurfaceNode
-                    || node == NodeType::WTR_Lod3SurfaceNode
-                    || node == NodeType::WTR_Lod4SurfaceNode
-                    || node == NodeType::WTR_BoundedByNode
-                    || node == NodeType::BLDG_AddressNode
-                    || node == NodeType::CORE_AddressNode
-                    || node == NodeType::CORE_XalAddressNode) {
+        default:
+            break;
+        }
 
+        AttributeType type;
+        if (getAttributeTypeOfAttributeNode(node, type)) {
+            if (!characters.empty()) {
+                m_model->setAttribute(node.name(), characters, type);
+            }
             return true;
         }
 
@@ -535,36 +488,69 @@ namespace citygml {
         return m_model;
     }
 
-    void CityObjectElementParser::parseGeometryForLODLevel(int lod)
+    bool CityObjectElementParser::skipGeometryForLODLevel(int lod, const NodeType::XMLNode& node)
+    {
+        const ParserParams& params = m_documentParser.getParserParams();
+        if (lod >= static_cast<int>(params.minLOD) && lod <= static_cast<int>(params.maxLOD)) {
+            return false;
+        }
+
+        // Skip the whole geometry property (including its child geometries and xlinks) so that nothing outside of the
+        // requested LOD range is created or registered at the factory
+        CITYGML_LOG_DEBUG(m_logger, "Skipping CityObject child element <" << node << "> at " << getDocumentLocation() << " (LOD " << lod << " is outside of the requested LOD range)");
+        setParserForNextElement(new SkipElementParser(m_documentParser, m_logger, node));
+        return true;
+    }
+
+    void CityObjectElementParser::parseGeometryForLODLevel(int lod, const NodeType::XMLNode& node)
     {
+        if (skipGeometryForLODLevel(lod, node)) {
+            return;
+        }
+
         setParserForNextElement(new GeometryElementParser(m_documentParser, m_factory, m_logger, lod, m_model->getType(), [this](Geometry* geom) {
             m_model->addGeometry(geom);
         }));
     }
 
-    void CityObjectElementParser::parseImplicitGeometryForLODLevel(int lod)
+    void CityObjectElementParser::parseImplicitGeometryForLODLevel(int lod, const NodeType::XMLNode& node)
     {
+        if (skipGeometryForLODLevel(lod, node)) {
+            return;
+        }
+
         setParserForNextElement(new ImplicitGeometryElementParser(m_documentParser, m_factory, m_logger, lod, m_model->getType(), [this](ImplicitGeometry* imp) {
             m_model->addImplictGeometry(imp);
         }));
     }
 
-    void CityObjectElementParser::parseGeometryPropertyElementForLODLevel(int lod, const std::string& id)
+    void CityObjectElementParser::parseGeometryPropertyElementForLODLevel(int lod, const NodeType::XMLNode& node, Attributes& attributes)
     {
+        if (skipGeometryForLODLevel(lod, node)) {
+            return;
+        }
+
+        const ObjectID id = getObjectID(attributes);
         setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, {
-            new PolygonElementParser(m_documentParser, m_factory, m_logger, [id, lod, this](std::shared_ptr<Polygon> p) {
-                                                                       Geometry* geom = m_factory.createGeometry(id, m_model->getType(), lod);
-                                                                       geom->addPolygon(p);
-                                                                       m_model->addGeometry(geom);
-                                                                   }),
-            new LineStringElementParser(m_documentParser, m_factory, m_logger, [id, lod, this](std::shared_ptr<LineString> l) {
-                                                                       Geometry* geom = m_factory.createGeometry(id, m_model->getType(), lod);
-                                                                       geom->addLineString(l);
-                                                                       m_model->addGeometry(geom);
-                                                                   }),
-            new GeometryElementParser(m_documentParser, m_factory, m_logger, lod, m_model->getType(), [this](Geometry* geom) {
-                                                                       m_model->addGeometry(geom);
-                                                                   })
+            DelayedChoiceElementParser::Choice("PolygonElementParser", &PolygonElementParser::isRootElement, [id, lod, this]() -> ElementParser* {
+                return new PolygonElementParser(m_documentParser, m_factory, m_logger, [id, lod, this](std::shared_ptr<Polygon> p) {
+                                                                           Geometry* geom = m_factory.createGeometry(id, m_model->getType(), lod);
+                                                                           geom->addPolygon(p);
+                                                                           m_model->addGeometry(geom);
+                                                                       });
+            }),
+            DelayedChoiceElementParser::Choice("LineStringElementParser", &LineStringElementParser::isRootElement, [id, lod, this]() -> ElementParser* {
+                return new LineStringElementParser(m_documentParser, m_factory, m_logger, [id, lod, this](std::shared_ptr<LineString> l) {
+                                                                           Geometry* geom = m_factory.createGeometry(id, m_model->getType(), lod);
+                                                                           geom->addLineString(l);
+                                                                           m_model->addGeometry(geom);
+                                                                       });
+            }),
+            DelayedChoiceElementParser::Choice("GeometryElementParser", &GeometryElementParser::isRootElement, [lod, this]() -> ElementParser* {
+                return new GeometryElementParser(m_documentParser, m_factory, m_logger, lod, m_model->getType(), [this](Geometry* geom) {
+                                                                           m_model->addGeometry(geom);
+                                                                       });
+            })
         }));
 
     }
@@ -10,21 +10,21 @@
 
 namespace citygml {
 
-    DelayedChoiceElementParser::DelayedChoiceElementParser(CityGMLDocumentParser& documentParser, std::shared_ptr<CityGMLLogger> logger, std::vector<ElementParser*> choices)
+    DelayedChoiceElementParser::DelayedChoiceElementParser(CityGMLDocumentParser& documentParser, std::shared_ptr<CityGMLLogger> logger, std::vector<Choice> choices)
         : ElementParser(documentParser, logger)
+        , m_choices(std::move(choices))
     {
-        m_choices = choices;
+
     }
 
     bool DelayedChoiceElementParser::startElement(const NodeType::XMLNode& node, Attributes& attributes)
     {
         ElementParser* choosenParser = nullptr;
-        for (ElementParser* parser : m_choices) {
+        for (const Choice& choice : m_choices) {
 
-            if (choosenParser == nullptr && parser->handlesElement(node)) {
-                choosenParser = parser;
-            } else {
-                delete parser;
+            if (choice.handlesElement(node)) {
+                choosenParser = choice.createParser();
+                break;
             }
 
         }
@@ -39,15 +39,15 @@ namespace citygml {
         }
     }
 
-    bool DelayedChoiceElementParser::endElement(const NodeType::XMLNode&, const std::string&)
+    bool DelayedChoiceElementParser::endElement(const NodeType::XMLNode&, const CharacterData&)
     {
         throw std::runtime_error("DelayedChoiceElementParser::endElement must never be called.");
     }
 
     bool DelayedChoiceElementParser::handlesElement(const NodeType::XMLNode& node) const
     {
-        for (const ElementParser* parser : m_choices) {
-            if (parser->handlesElement(node)) {
+        for (const Choice& choice : m_choices) {
+            if (choice.handlesElement(node)) {
                 return true;
             }
         }
@@ -64,7 +64,7 @@ namespace citygml {
                 ss << " | ";
             }
 
-            ss << m_choices[i]->elementParserName();
+            ss << m_choices[i].parserName;
         }
 
         ss << ")";
@@ -0,0 +1,291 @@
+#include "parser/documentchunks.h"
+
+#include <citygml/citygmllogger.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <string>
+
+namespace citygml {
+
+    namespace {
+
+        const size_t npos = std::string::npos;
+
+        bool startsWith(const char* data, size_t pos, size_t size, const char* pattern)
+        {
+            const size_t length = strlen(pattern);
+            return pos + length <= size && memcmp(data + pos, pattern, length) == 0;
+        }
+
+        /**
+         * @brief the position behind the first occurrence of pattern in [pos, size) or npos if there is none
+         */
+        size_t skipBehind(const char* data, size_t pos, size_t size, const char* pattern)
+        {
+            const size_t length = strlen(pattern);
+            while (pos + length <= size) {
+                const char* found = static_cast<const char*>(memchr(data + pos, pattern[0], size - pos - length + 1));
+                if (found == nullptr) {
+                    return npos;
+                }
+                pos = static_cast<size_t>(found - data);
+                if (memcmp(found, pattern, length) == 0) {
+                    return pos + length;
+                }
+                pos++;
+            }
+            return npos;
+        }
+
+        /**
+         * @brief the position behind the '>' that closes the markup starting in front of pos or npos if there is none
+         *
+         * Skips quoted attribute values and the internal subset of a document type declaration.
+         */
+        size_t skipMarkup(const char* data, size_t pos, size_t size)
+        {
+            char quote = 0;
+            int brackets = 0;
+            for (; pos < size; pos++) {
+                const char c = data[pos];
+                if (quote != 0) {
+                    if (c == quote) {
+                        quote = 0;
+                    }
+                } else if (c == '"' || c == '\'') {
+                    quote = c;
+                } else if (c == '[') {
+                    brackets++;
+                } else if (c == ']') {
+                    brackets--;
+                } else if (c == '>' && brackets <= 0) {
+                    return pos + 1;
+                }
+            }
+            return npos;
+        }
+
+        bool isMarkupWhitespace(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+        }
+
+        /**
+         * @brief checks (case insensitive like NodeType::getXMLNodeFor) if the local part of the element name [begin, end) is localName
+         * @param localName the lower case local name
+         */
+        bool hasLocalName(const char* begin, const char* end, const char* localName)
+        {
+            const char* colon = static_cast<const char*>(memchr(begin, ':', static_cast<size_t>(end - begin)));
+            if (colon != nullptr) {
+                begin = colon + 1;
+            }
+
+            const size_t length = strlen(localName);
+            if (static_cast<size_t>(end - begin) != length) {
+                return false;
+            }
+
+            for (size_t i = 0; i < length; i++) {
+                if (tolower(static_cast<unsigned char>(begin[i])) != localName[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief checks if the attributes [begin, end) of a start tag contain an (xlink:)href attribute
+         */
+        bool hasHrefAttribute(const char* begin, const char* end)
+        {
+            char quote = 0;
+            for (const char* it = begin; it + 4 < end; it++) {
+                if (quote != 0) {
+                    if (*it == quote) {
+                        quote = 0;
+                    }
+                } else if (*it == '"' || *it == '\'') {
+                    quote = *it;
+                } else if ((isMarkupWhitespace(*it) || *it == ':') && memcmp(it + 1, "href", 4) == 0) {
+                    const char* next = it + 5;
+                    while (next != end && isMarkupWhitespace(*next)) {
+                        next++;
+                    }
+                    if (next != end && *next == '=') {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief counts the lines up to target
+         * @param pos the position up to which the lines are counted, set to target
+         * @param line the line number of pos
+         * @param lineBegin the position of the first character of the line of pos
+         */
+        void advanceLines(const char* data, size_t& pos, size_t target, uint64_t& line, size_t& lineBegin)
+        {
+            while (pos < target) {
+                const char* newline = static_cast<const char*>(memchr(data + pos, '\n', target - pos));
+                if (newline == nullptr) {
+                    break;
+                }
+                pos = static_cast<size_t>(newline - data) + 1;
+                line++;
+                lineBegin = pos;
+            }
+            pos = target;
+        }
+
+    }
+
+    bool splitDocumentAtCityObjectMembers(const char* data, size_t size, size_t maxChunks, size_t minChunkSize, DocumentChunks& result,
+                                          std::shared_ptr<CityGMLLogger> logger)
+    {
+        if (maxChunks < 2 || size < 2) {
+            return false;
+        }
+
+        // UTF-16 and UTF-32 documents can not be scanned bytewise
+        const unsigned char first = static_cast<unsigned char>(data[0]);
+        const unsigned char second = static_cast<unsigned char>(data[1]);
+        if (first == 0 || second == 0 || (first == 0xFE && second == 0xFF) || (first == 0xFF && second == 0xFE)) {
+            CITYGML_LOG_INFO(logger, "The document is not encoded in an ASCII compatible encoding. It is parsed in one chunk.");
+            return false;
+        }
+
+        size_t prologEnd = npos;
+        size_t rootEndTagBegin = npos;
+        size_t rootEndTagEnd = npos;
+
+        // the positions of the cityObjectMember start tags in the root element
+        std::vector<size_t> boundaries;
+
+        int depth = 0;
+        size_t pos = 0;
+        while (pos < size) {
+            const char* found = static_cast<const char*>(memchr(data + pos, '<', size - pos));
+            if (found == nullptr) {
+                break;
+            }
+            pos = static_cast<size_t>(found - data);
+
+            if (startsWith(data, pos, size, "<!--")) {
+                pos = skipBehind(data, pos + 4, size, "-->");
+            } else if (startsWith(data, pos, size, "<![CDATA[")) {
+                pos = skipBehind(data, pos + 9, size, "]]>");
+            } else if (startsWith(data, pos, size, "<?")) {
+                pos = skipBehind(data, pos + 2, size, "?>");
+            } else if (startsWith(data, pos, size, "<!")) {
+                pos = skipMarkup(data, pos + 2, size);
+            } else {
+                const size_t tagBegin = pos;
+                const size_t tagEnd = skipMarkup(data, pos + 1, size);
+                if (tagEnd == npos) {
+                    break;
+                }
+                pos = tagEnd;
+
+                if (data[tagBegin + 1] == '/') {
+                    depth--;
+                    if (depth == 0) {
+                        rootEndTagBegin = tagBegin;
+                        rootEndTagEnd = tagEnd;
+                        break;
+                    }
+                    continue;
+                }
+
+                const bool emptyElement = data[tagEnd - 2] == '/';
+
+                const char* nameBegin = data + tagBegin + 1;
+                const char* nameEnd = nameBegin;
+                while (nameEnd < data + tagEnd - 1 && !isMarkupWhitespace(*nameEnd) && *nameEnd != '/' && *nameEnd != '>') {
+                    nameEnd++;
+                }
+
+                if (depth == 0) {
+                    if (emptyElement) {
+                        return false;
+                    }
+                    prologEnd = tagEnd;
+                } else if (depth == 1 && hasLocalName(nameBegin, nameEnd, "cityobjectmember")) {
+                    boundaries.push_back(tagBegin);
+                } else if (hasLocalName(nameBegin, nameEnd, "surfacedatamember") && hasHrefAttribute(nameEnd, data + tagEnd)) {
+                    CITYGML_LOG_INFO(logger, "The document contains surfaceDataMember elements with xlinks. It is parsed in one chunk.");
+                    return false;
+                }
+
+                if (!emptyElement) {
+                    depth++;
+                }
+            }
+        }
+
+        if (prologEnd == npos || rootEndTagBegin == npos) {
+            CITYGML_LOG_INFO(logger, "The end of the root element of the document was not found. It is parsed in one chunk.");
+            return false;
+        }
+
+        const size_t contentSize = rootEndTagBegin - prologEnd;
+        size_t chunkCount = std::min(maxChunks, boundaries.size());
+        if (minChunkSize > 0) {
+            chunkCount = std::min(chunkCount, contentSize / minChunkSize);
+        }
+        if (chunkCount < 2) {
+            return false;
+        }
+
+        result.prologEnd = prologEnd;
+        result.rootEndTagBegin = rootEndTagBegin;
+        result.rootEndTagEnd = rootEndTagEnd;
+        result.chunks.clear();
+
+        // Line of the end of the prolog, i.e. the line of the chunk document in which the chunk begins
+        size_t linePos = 0;
+        uint64_t line = 1;
+        size_t lineBegin = 0;
+        advanceLines(data, linePos, prologEnd, line, lineBegin);
+        const uint64_t prologEndLine = line;
+        const int64_t prologEndColumn = static_cast<int64_t>(prologEnd - lineBegin);
+
+        std::vector<size_t>::const_iterator next = boundaries.begin();
+        size_t chunkBegin = prologEnd;
+        for (size_t i = 1; i <= chunkCount; i++) {
+            size_t chunkEnd = rootEndTagBegin;
+            if (i < chunkCount) {
+                // Split in front of the first cityObjectMember behind the target size
+                next = std::lower_bound(next, boundaries.cend(), prologEnd + contentSize / chunkCount * i);
+                if (next == boundaries.cend()) {
+                    continue;
+                }
+                chunkEnd = *next;
+                ++next;
+            }
+
+            if (chunkEnd <= chunkBegin) {
+                continue;
+            }
+
+            advanceLines(data, linePos, chunkBegin, line, lineBegin);
+
+            DocumentChunk chunk;
+            chunk.begin = chunkBegin;
+            chunk.end = chunkEnd;
+            chunk.firstLine = prologEndLine;
+            chunk.lineOffset = static_cast<int64_t>(line - prologEndLine);
+            chunk.columnOffset = static_cast<int64_t>(chunkBegin - lineBegin) - prologEndColumn;
+            result.chunks.push_back(chunk);
+
+            chunkBegin = chunkEnd;
+        }
+
+        return result.chunks.size() > 1;
+    }
+
+}
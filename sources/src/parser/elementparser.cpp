@@ -2,8 +2,112 @@
 
 #include "parser/citygmldocumentparser.h"
 
+#include <new>
+
 namespace citygml {
 
+    namespace {
+
+        /**
+         * @brief free lists of memory blocks for element parsers
+         *
+         * The blocks are grouped in size classes of 16 bytes, i.e. in practice there is one list per parser type. Parsers that are
+         * larger than the largest size class are allocated on the heap directly.
+         */
+        class ElementParserPool {
+        public:
+            ElementParserPool()
+            {
+                for (size_t i = 0; i < SizeClasses; i++) {
+                    m_freeBlocks[i] = nullptr;
+                    m_freeBlockCounts[i] = 0;
+                }
+            }
+
+            ~ElementParserPool()
+            {
+                for (size_t i = 0; i < SizeClasses; i++) {
+                    while (m_freeBlocks[i] != nullptr) {
+                        FreeBlock* block = m_freeBlocks[i];
+                        m_freeBlocks[i] = block->next;
+                        ::operator delete(block);
+                    }
+                }
+            }
+
+            void* allocate(size_t size)
+            {
+                const size_t sizeClass = getSizeClass(size);
+                if (sizeClass >= SizeClasses) {
+                    return ::operator new(size);
+                }
+
+                FreeBlock* block = m_freeBlocks[sizeClass];
+                if (block == nullptr) {
+                    return ::operator new((sizeClass + 1) * Granularity);
+                }
+
+                m_freeBlocks[sizeClass] = block->next;
+                m_freeBlockCounts[sizeClass]--;
+                return block;
+            }
+
+            void deallocate(void* ptr, size_t size)
+            {
+                const size_t sizeClass = getSizeClass(size);
+                if (sizeClass >= SizeClasses || m_freeBlockCounts[sizeClass] >= MaxFreeBlocks) {
+                    ::operator delete(ptr);
+                    return;
+                }
+
+                FreeBlock* block = static_cast<FreeBlock*>(ptr);
+                block->next = m_freeBlocks[sizeClass];
+                m_freeBlocks[sizeClass] = block;
+                m_freeBlockCounts[sizeClass]++;
+            }
+
+        private:
+            struct FreeBlock {
+                FreeBlock* next;
+            };
+
+            static const size_t Granularity = 16;
+            static const size_t SizeClasses = 64;
+
+            // The number of parsers of a type that exist at the same time is bounded by the nesting depth of the elements
+            static const size_t MaxFreeBlocks = 256;
+
+            static size_t getSizeClass(size_t size)
+            {
+                return size == 0 ? 0 : (size - 1) / Granularity;
+            }
+
+            FreeBlock* m_freeBlocks[SizeClasses];
+            size_t m_freeBlockCounts[SizeClasses];
+        };
+
+        // Every document is parsed by a single thread (document chunks are parsed by different threads), hence each thread
+        // recycles its own parsers
+        ElementParserPool& getElementParserPool()
+        {
+            thread_local ElementParserPool pool;
+            return pool;
+        }
+
+    }
+
+    void* ElementParser::operator new(size_t size)
+    {
+        return getElementParserPool().allocate(size);
+    }
+
+    void ElementParser::operator delete(void* ptr, size_t size)
+    {
+        if (ptr != nullptr) {
+            getElementParserPool().deallocate(ptr, size);
+        }
+    }
+
     void ElementParser::setParserForNextElement(ElementParser* parser)
     {
         m_documentParser.setCurrentElementParser(parser);
@@ -14,6 +118,16 @@ namespace citygml {
         return m_documentParser.getDocumentLocation();
     }
 
+    bool ElementParser::requiresCharacterData() const
+    {
+        return true;
+    }
+
+    ObjectID ElementParser::getObjectID(const Attributes& attributes)
+    {
+        return m_documentParser.getObjectID(attributes);
+    }
+
     ElementParser::~ElementParser()
     {
 
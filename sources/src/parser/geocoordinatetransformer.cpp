@@ -1,6 +1,7 @@
 #include "parser/geocoordinatetransformer.h"
 
 #include <citygml/citygmllogger.h>
+#include <citygml/tracing.h>
 #include <citygml/citymodel.h>
 #include <citygml/cityobject.h>
 #include <citygml/implictgeometry.h>
@@ -130,8 +131,34 @@ namespace citygml {
         m_logger = logger;
     }
 
+    GeoCoordinateTransformer::~GeoCoordinateTransformer()
+    {
+    }
+
+    void GeoCoordinateTransformer::transformToDestinationSRS(CityObject& obj, const std::string& modelSRS)
+    {
+        CITYGML_TRACE_SCOPE_DETAIL("transform CityObject", obj.getId());
+
+        // Reuse the transformation of the model srs for all objects
+        if (m_modelTransformation == nullptr || m_modelSRS != modelSRS) {
+            m_modelTransformation = std::unique_ptr<GeoTransform>(new GeoTransform(m_destinationSRS, m_logger));
+            if (!modelSRS.empty()) {
+                m_modelTransformation->setSourceSRS(modelSRS);
+            }
+            m_modelSRS = modelSRS;
+        }
+
+        // The objects handed out before may have been deleted already, hence polygon addresses may be reused
+        m_transformedPolygonsSourceURNMap.clear();
+        m_transformedLineStringsSourceURNMap.clear();
+
+        transformRecursive(obj, *m_modelTransformation);
+    }
+
     void GeoCoordinateTransformer::transformToDestinationSRS(CityModel* model)
     {
+        CITYGML_TRACE_SCOPE("transform CityModel");
+
         GeoTransform transformation(m_destinationSRS, m_logger);
 
         if (!model->getEnvelope().srsName().empty()) {
@@ -191,7 +218,7 @@ namespace citygml {
 
                 obj.setEnvelope(newEnvelope);
             } else {
-                CITYGML_LOG_WARN(m_logger, "No valid spatial reference system is given for CityObject with id '" << obj.getId() << "'. Envelope (Bounding Box) is not transformed.");
+                CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_MISSING_SRS, "No valid spatial reference system is given for CityObject with id '" << obj.getId() << "'. Envelope (Bounding Box) is not transformed.");
             }
         }
 
@@ -229,7 +256,7 @@ namespace citygml {
             obj.setReferencePoint(referencePoint);
             obj.setSRSName(m_destinationSRS);
         } else {
-            CITYGML_LOG_WARN(m_logger, "No valid spatial reference system is given for ImplicitGeometry with id '" << obj.getId() << "'. Reference Point is not transformed.");
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_MISSING_SRS, "No valid spatial reference system is given for ImplicitGeometry with id '" << obj.getId() << "'. Reference Point is not transformed.");
         }
 
         // Do not transform the geometry of an ImplicitGeometry object. Implicit Geometries share Geometry objects but each implicit geometry
@@ -243,7 +270,7 @@ namespace citygml {
     void GeoCoordinateTransformer::transform(Geometry& obj, GeoTransform& transformation) {
 
         if (!transformation.valid()) {
-            CITYGML_LOG_WARN(m_logger, "No valid spatial reference system is given for Geometry with id '" << obj.getId() << "'. Child Polygons are not transformed"
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_MISSING_SRS, "No valid spatial reference system is given for Geometry with id '" << obj.getId() << "'. Child Polygons are not transformed"
                                        << "(unless they are shared with another geometry for which a spatial reference system is defined)");
             return;
         }
@@ -313,10 +340,22 @@ namespace citygml {
 		m_logger = logger;
 	}
 
+	GeoCoordinateTransformer::~GeoCoordinateTransformer()
+	{
+	}
+
     void GeoCoordinateTransformer::transformToDestinationSRS(CityModel* model) {
         CITYGML_LOG_WARN(m_logger, "Coordinate transformation to " << m_destinationSRS << " requested, but libcitygml was build without GDAL. The coordinates will not be transformed.");
     }
 
+    void GeoCoordinateTransformer::transformToDestinationSRS(CityObject&, const std::string&) {
+        // Warn only once
+        if (m_modelTransformation == nullptr) {
+            CITYGML_LOG_WARN(m_logger, "Coordinate transformation to " << m_destinationSRS << " requested, but libcitygml was build without GDAL. The coordinates will not be transformed.");
+            m_modelTransformation = std::unique_ptr<GeoTransform>(new GeoTransform());
+        }
+    }
+
     void GeoCoordinateTransformer::transformRecursive(CityObject&, GeoTransform&) {}
     void GeoCoordinateTransformer::transformRecursive_helper(CityObject&, GeoTransform&) {}
     void GeoCoordinateTransformer::transformRecursive(ImplicitGeometry&, GeoTransform&) {}
@@ -1,7 +1,5 @@
 #include "parser/geometryelementparser.h"
 
-#include <unordered_set>
-
 #include "parser/nodetypes.h"
 #include "parser/attributes.h"
 #include "parser/documentlocation.h"
@@ -14,18 +12,10 @@
 #include <citygml/citygmllogger.h>
 #include <citygml/polygon.h>
 
-#include <mutex>
-
 #include <stdexcept>
 
 namespace citygml {
 
-
-    // The nodes that are valid Geometry Objects
-    std::unordered_set<int> geometryTypeIDSet;
-    bool geometryTypeIDSetInitialized = false;
-    std::mutex geometryElement_initializedTypeIDMutex;
-
     GeometryElementParser::GeometryElementParser(CityGMLDocumentParser& documentParser, CityGMLFactory& factory, std::shared_ptr<CityGMLLogger> logger,
                                                  int lodLevel, CityObject::CityObjectsType parentType,  std::function<void(Geometry*)> callback)
         : GMLObjectElementParser(documentParser, factory, logger)
@@ -42,30 +32,27 @@ namespace citygml {
 
     bool GeometryElementParser::handlesElement(const NodeType::XMLNode& node) const
     {
-        if(!geometryTypeIDSetInitialized) {
-
-            std::lock_guard<std::mutex> lock(geometryElement_initializedTypeIDMutex);
-
-            if (!geometryTypeIDSetInitialized) {
-
-                geometryTypeIDSet.insert(NodeType::GML_CompositeSolidNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_SolidNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_MultiSurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_CompositeSurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_TriangulatedSurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_OrientableSurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_MultiSolidNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_CompositeSolidNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_ShellNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_PolyhedralSurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_SurfaceNode.typeID());
-                geometryTypeIDSet.insert(NodeType::GML_ShellNode.typeID());
-                geometryTypeIDSetInitialized = true;
+        return isRootElement(node);
+    }
 
-            }
+    bool GeometryElementParser::isRootElement(const NodeType::XMLNode& node)
+    {
+        // The nodes that are valid Geometry Objects
+        switch (node.typeID()) {
+        case NodeType::GML_CompositeSolidTypeID:
+        case NodeType::GML_SolidTypeID:
+        case NodeType::GML_MultiSurfaceTypeID:
+        case NodeType::GML_CompositeSurfaceTypeID:
+        case NodeType::GML_TriangulatedSurfaceTypeID:
+        case NodeType::GML_OrientableSurfaceTypeID:
+        case NodeType::GML_MultiSolidTypeID:
+        case NodeType::GML_ShellTypeID:
+        case NodeType::GML_PolyhedralSurfaceTypeID:
+        case NodeType::GML_SurfaceTypeID:
+            return true;
+        default:
+            return false;
         }
-
-        return geometryTypeIDSet.count(node.typeID()) > 0;
     }
 
     bool GeometryElementParser::parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
@@ -76,13 +63,13 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createGeometry(attributes.getCityGMLIDAttribute(), m_parentType, m_lodLevel);
-        m_orientation = attributes.getAttribute("orientation", "+"); // A gml:OrientableSurface may define a negative orientation
+        m_model = m_factory.createGeometry(getObjectID(attributes), m_parentType, m_lodLevel);
+        m_orientation = attributes.getAttribute(AttributeName::Orientation, "+"); // A gml:OrientableSurface may define a negative orientation
         return true;
 
     }
 
-    bool GeometryElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool GeometryElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         if (m_orientation == "-") {
             for (int i = 0; i < m_model->getPolygonsCount(); i++) {
@@ -102,61 +89,73 @@ namespace citygml {
             throw std::runtime_error("GeometryElementParser::parseChildElementStartTag called before GeometryElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::GML_InteriorNode
-         || node == NodeType::GML_ExteriorNode
-         || node == NodeType::GML_SolidMemberNode) {
+        switch (node.typeID()) {
+        case NodeType::GML_InteriorTypeID:
+        case NodeType::GML_ExteriorTypeID:
+        case NodeType::GML_SolidMemberTypeID:
 
             setParserForNextElement(new GeometryElementParser(m_documentParser, m_factory, m_logger, m_lodLevel, m_parentType, [this](Geometry* child) {
                                         m_model->addGeometry(child);
                                     }));
             return true;
 
-        } else if (node == NodeType::GML_SurfaceMemberNode
-                   || node == NodeType::GML_BaseSurfaceNode) {
+        case NodeType::GML_SurfaceMemberTypeID:
+        case NodeType::GML_BaseSurfaceTypeID: {
 
-            if (attributes.hasXLinkAttribute()) {
-                m_factory.requestSharedPolygonForGeometry(m_model, attributes.getXLinkValue());
+            std::string polygonID;
+            if (attributes.getXLinkReference(polygonID)) {
+                m_factory.requestSharedPolygonForGeometry(m_model, polygonID, getDocumentPosition(getDocumentLocation()));
             } else {
-                std::vector<ElementParser*> parsers;
-
-                std::function<void(std::shared_ptr<Polygon>)> callback1 = [this](std::shared_ptr<Polygon> poly) {m_model->addPolygon(poly);};
-                std::function<void(Geometry*)>                callback2 = [this](Geometry* child) {m_model->addGeometry(child);};
+                std::vector<DelayedChoiceElementParser::Choice> choices;
 
-                parsers.push_back(new PolygonElementParser(m_documentParser, m_factory, m_logger, callback1));
-                parsers.push_back(new GeometryElementParser(m_documentParser, m_factory, m_logger, m_lodLevel, m_parentType, callback2));
+                choices.emplace_back("PolygonElementParser", &PolygonElementParser::isRootElement, [this]() -> ElementParser* {
+                    return new PolygonElementParser(m_documentParser, m_factory, m_logger, [this](std::shared_ptr<Polygon> poly) {m_model->addPolygon(poly);});
+                });
+                choices.emplace_back("GeometryElementParser", &GeometryElementParser::isRootElement, [this]() -> ElementParser* {
+                    return new GeometryElementParser(m_documentParser, m_factory, m_logger, m_lodLevel, m_parentType, [this](Geometry* child) {m_model->addGeometry(child);});
+                });
 
-                setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, parsers));
+                setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, std::move(choices)));
             }
             return true;
-        } else if (node == NodeType::GML_PatchesNode
-                   || node == NodeType::GML_TrianglePatchesNode) {
+        }
+
+        case NodeType::GML_PatchesTypeID:
+        case NodeType::GML_TrianglePatchesTypeID: {
 
             std::function<ElementParser*()> patchParserFactory = [this]() {
                 return new PolygonElementParser(m_documentParser, m_factory, m_logger, [this](std::shared_ptr<Polygon> poly) {m_model->addPolygon(poly);});
             };
 
             setParserForNextElement(new SequenceParser(m_documentParser, m_logger, patchParserFactory, node));
+            break;
+        }
 
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool GeometryElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool GeometryElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
 
         if (m_model == nullptr) {
             throw std::runtime_error("GeometryElementParser::parseChildElementEndTag called before GeometryElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::GML_InteriorNode
-         || node == NodeType::GML_ExteriorNode
-         || node == NodeType::GML_SolidMemberNode
-         || node == NodeType::GML_SurfaceMemberNode
-         || node == NodeType::GML_BaseSurfaceNode
-         || node == NodeType::GML_PatchesNode
-         || node == NodeType::GML_TrianglePatchesNode)  {
+        switch (node.typeID()) {
+        case NodeType::GML_InteriorTypeID:
+        case NodeType::GML_ExteriorTypeID:
+        case NodeType::GML_SolidMemberTypeID:
+        case NodeType::GML_SurfaceMemberTypeID:
+        case NodeType::GML_BaseSurfaceTypeID:
+        case NodeType::GML_PatchesTypeID:
+        case NodeType::GML_TrianglePatchesTypeID:
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementEndTag(node, characters);
@@ -28,6 +28,11 @@ namespace citygml {
     }
 
     bool GeoReferencedTextureElementParser::handlesElement(const NodeType::XMLNode& node) const
+    {
+        return isRootElement(node);
+    }
+
+    bool GeoReferencedTextureElementParser::isRootElement(const NodeType::XMLNode& node)
     {
         return node == NodeType::APP_GeoreferencedTextureNode;
     }
@@ -44,7 +49,7 @@ namespace citygml {
         return true;
     }
 
-    bool GeoReferencedTextureElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool GeoReferencedTextureElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         // Not Implemented
         return true;
@@ -56,7 +61,7 @@ namespace citygml {
         return true;
     }
 
-    bool GeoReferencedTextureElementParser::parseChildElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool GeoReferencedTextureElementParser::parseChildElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         setParserForNextElement(new SkipElementParser(m_documentParser, m_logger));
         return true;
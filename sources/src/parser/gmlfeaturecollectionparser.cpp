@@ -27,55 +27,52 @@ namespace citygml {
             throw std::runtime_error("Invalid call to GMLFeatureCollectionElementParser::parseChildElementStartTag");
         }
 
-        if (node == NodeType::GML_LowerCornerNode
-                || node == NodeType::GML_UpperCornerNode
-                || node == NodeType::GML_BoundedByNode) {
+        switch (node.typeID()) {
+        case NodeType::GML_LowerCornerTypeID:
+        case NodeType::GML_UpperCornerTypeID:
+        case NodeType::GML_BoundedByTypeID:
             return true;
-        } else if (node == NodeType::GML_EnvelopeNode) {
-
+        case NodeType::GML_EnvelopeTypeID:
             if (m_bounds != nullptr) {
                 CITYGML_LOG_WARN(m_logger, "Duplicate definition of " << NodeType::GML_EnvelopeNode << " at " << getDocumentLocation());
                 return true;
             }
-            m_bounds = new Envelope(attributes.getAttribute("srsName"));
+            m_bounds = new Envelope(attributes.getAttribute(AttributeName::SRSName));
             return true;
+        default:
+            return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
         }
-
-        return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool GMLFeatureCollectionElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool GMLFeatureCollectionElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (getFeatureObject() == nullptr) {
             throw std::runtime_error("Invalid call to GMLFeatureCollectionElementParser::parseChildElementEndTag");
         }
 
-        if (node == NodeType::GML_LowerCornerNode) {
-
+        switch (node.typeID()) {
+        case NodeType::GML_LowerCornerTypeID:
             if (m_bounds != nullptr) {
                 m_bounds->setLowerBound(parseValue<TVec3d>(characters, m_logger, getDocumentLocation()));
             } else {
                 CITYGML_LOG_WARN(m_logger, "Definition of " << NodeType::GML_LowerCornerNode << " outside " << NodeType::GML_EnvelopeNode << " at " << getDocumentLocation());
             }
             return true;
-        } else if (node == NodeType::GML_UpperCornerNode) {
-
+        case NodeType::GML_UpperCornerTypeID:
             if (m_bounds != nullptr) {
                 m_bounds->setUpperBound(parseValue<TVec3d>(characters, m_logger, getDocumentLocation()));
             } else {
                 CITYGML_LOG_WARN(m_logger, "Definition of " << NodeType::GML_UpperCornerNode << " outside " << NodeType::GML_EnvelopeNode << " at " << getDocumentLocation());
             }
             return true;
-        } else if (node == NodeType::GML_EnvelopeNode) {
-
+        case NodeType::GML_EnvelopeTypeID:
             getFeatureObject()->setEnvelope(m_bounds);
             return true;
-        } else if (node == NodeType::GML_BoundedByNode) {
-
+        case NodeType::GML_BoundedByTypeID:
             return true;
+        default:
+            return GMLObjectElementParser::parseChildElementEndTag(node, characters);
         }
-
-        return GMLObjectElementParser::parseChildElementEndTag(node, characters);
     }
 
     Object* GMLFeatureCollectionElementParser::getObject()
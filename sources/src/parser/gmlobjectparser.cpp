@@ -1,4 +1,5 @@
 #include "parser/gmlobjectparser.h"
+#include "parser/characterdata.h"
 
 #include <citygml/object.h>
 
@@ -16,35 +17,35 @@ namespace citygml {
             throw std::runtime_error("Invalid call to GMLObjectElementParser::parseChildElementStartTag");
         }
 
-        if (   node == NodeType::GML_DescriptionNode
-            || node == NodeType::GML_IdentifierNode
-            || node == NodeType::GML_NameNode
-            || node == NodeType::GML_DescriptionReferenceNode
-            || node == NodeType::GML_MetaDataPropertyNode) {
-
+        switch (node.typeID()) {
+        case NodeType::GML_DescriptionTypeID:
+        case NodeType::GML_IdentifierTypeID:
+        case NodeType::GML_NameTypeID:
+        case NodeType::GML_DescriptionReferenceTypeID:
+        case NodeType::GML_MetaDataPropertyTypeID:
             return true;
+        default:
+            return false;
         }
-
-        return false;
     }
 
-    bool GMLObjectElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool GMLObjectElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (getObject() == nullptr) {
             throw std::runtime_error("Invalid call to GMLObjectElementParser::parseChildElementEndTag");
         }
 
-        if (   node == NodeType::GML_DescriptionNode
-            || node == NodeType::GML_IdentifierNode
-            || node == NodeType::GML_NameNode
-            || node == NodeType::GML_DescriptionReferenceNode
-            || node == NodeType::GML_MetaDataPropertyNode) {
-
-                getObject()->setAttribute(node.name(), characters);
-                return true;
+        switch (node.typeID()) {
+        case NodeType::GML_DescriptionTypeID:
+        case NodeType::GML_IdentifierTypeID:
+        case NodeType::GML_NameTypeID:
+        case NodeType::GML_DescriptionReferenceTypeID:
+        case NodeType::GML_MetaDataPropertyTypeID:
+            getObject()->setAttribute(node.name(), characters);
+            return true;
+        default:
+            return false;
         }
-
-        return false;
     }
 
 }
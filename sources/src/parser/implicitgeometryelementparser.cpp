@@ -48,12 +48,12 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createImplictGeometry(attributes.getCityGMLIDAttribute());
+        m_model = m_factory.createImplictGeometry(getObjectID(attributes));
         return true;
 
     }
 
-    bool ImplicitGeometryElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool ImplicitGeometryElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         return true;
@@ -67,86 +67,92 @@ namespace citygml {
             throw std::runtime_error("ImplicitGeometryElementParser::parseChildElementStartTag called before ImplicitGeometryElementParser::parseElementStartTag");
         }
 
-        if (   node == NodeType::CORE_TransformationMatrixNode
-            || node == NodeType::CORE_ReferencePointNode
-            || node == NodeType::GML_ReferencePointNode
-            || node == NodeType::CORE_MimeTypeNode) {
-
+        switch (node.typeID()) {
+        case NodeType::CORE_TransformationMatrixTypeID:
+        case NodeType::CORE_ReferencePointTypeID:
+        case NodeType::GML_ReferencePointTypeID:
+        case NodeType::CORE_MimeTypeTypeID:
             return true;
-
-        } else if (node == NodeType::GML_PointNode) {
-
-            m_model->setSRSName(attributes.getAttribute("srsName"));
+        case NodeType::GML_PointTypeID:
+            m_model->setSRSName(attributes.getAttribute(AttributeName::SRSName));
             return true;
-        } else if (node == NodeType::GML_PosNode) {
-
-            std::string srsDimension = attributes.getAttribute("srsDimension","3");
+        case NodeType::GML_PosTypeID: {
+            std::string srsDimension = attributes.getAttribute(AttributeName::SRSDimension, "3");
             if (srsDimension != "3") {
                 CITYGML_LOG_WARN(m_logger, NodeType::GML_PosNode << " element at " << getDocumentLocation() << " in ImplicitGeometry node has an unsupported 'srsDimension' attribute value of " << srsDimension
                                  << " (Only 3 is supported). Trying to parse it anyway.");
             }
             return true;
-        } else if (node == NodeType::CORE_RelativeGMLGeometryNode) {
-
-            if (attributes.hasXLinkAttribute()) {
+        }
+        case NodeType::CORE_RelativeGMLGeometryTypeID: {
+            std::string sharedGeomID;
+            if (attributes.getXLinkReference(sharedGeomID)) {
 
-                std::string sharedGeomID = attributes.getXLinkValue();
-                m_factory.requestSharedGeometryWithID(m_model, sharedGeomID);
+                m_factory.requestSharedGeometryWithID(m_model, sharedGeomID, getDocumentPosition(getDocumentLocation()));
             } else {
 
-                std::string id = attributes.getCityGMLIDAttribute();
+                const ObjectID id = getObjectID(attributes);
 
                 setParserForNextElement(new DelayedChoiceElementParser(m_documentParser, m_logger, {
-                    new PolygonElementParser(m_documentParser, m_factory, m_logger, [id, this](std::shared_ptr<Polygon> p) {
-                                                                               Geometry* geom = m_factory.createGeometry(id, m_parentType, m_lodLevel);
-                                                                               geom->addPolygon(p);
-                                                                               m_model->addGeometry(m_factory.shareGeometry(geom));
-                                                                           }),
-                    new LineStringElementParser(m_documentParser, m_factory, m_logger, [id, this](std::shared_ptr<LineString> l) {
-                                                                               Geometry* geom = m_factory.createGeometry(id, m_parentType, m_lodLevel);
-                                                                               geom->addLineString(l);
-                                                                               m_model->addGeometry(m_factory.shareGeometry(geom));
-                                                                           }),
-                    new GeometryElementParser(m_documentParser, m_factory, m_logger, m_lodLevel, m_parentType, [this](Geometry* geom) {
-                                                                               m_model->addGeometry(m_factory.shareGeometry(geom));
-                                                                           })
+                    DelayedChoiceElementParser::Choice("PolygonElementParser", &PolygonElementParser::isRootElement, [id, this]() -> ElementParser* {
+                        return new PolygonElementParser(m_documentParser, m_factory, m_logger, [id, this](std::shared_ptr<Polygon> p) {
+                                                                                   Geometry* geom = m_factory.createGeometry(id, m_parentType, m_lodLevel);
+                                                                                   geom->addPolygon(p);
+                                                                                   m_model->addGeometry(m_factory.shareGeometry(geom));
+                                                                               });
+                    }),
+                    DelayedChoiceElementParser::Choice("LineStringElementParser", &LineStringElementParser::isRootElement, [id, this]() -> ElementParser* {
+                        return new LineStringElementParser(m_documentParser, m_factory, m_logger, [id, this](std::shared_ptr<LineString> l) {
+                                                                                   Geometry* geom = m_factory.createGeometry(id, m_parentType, m_lodLevel);
+                                                                                   geom->addLineString(l);
+                                                                                   m_model->addGeometry(m_factory.shareGeometry(geom));
+                                                                               });
+                    }),
+                    DelayedChoiceElementParser::Choice("GeometryElementParser", &GeometryElementParser::isRootElement, [this]() -> ElementParser* {
+                        return new GeometryElementParser(m_documentParser, m_factory, m_logger, m_lodLevel, m_parentType, [this](Geometry* geom) {
+                                                                                   m_model->addGeometry(m_factory.shareGeometry(geom));
+                                                                               });
+                    })
                 }));
             }
             return true;
-        } else if (node == NodeType::CORE_LibraryObjectNode) {
+        }
+        case NodeType::CORE_LibraryObjectTypeID:
             CITYGML_LOG_INFO(m_logger, "Skipping ImplicitGeometry child element <" << node  << ">  at " << getDocumentLocation() << " (Currently not supported!)");
             setParserForNextElement(new SkipElementParser(m_documentParser, m_logger));
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool ImplicitGeometryElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool ImplicitGeometryElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
 
         if (m_model == nullptr) {
             throw std::runtime_error("ImplicitGeometryElementParser::parseChildElementEndTag called before ImplicitGeometryElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::CORE_TransformationMatrixNode) {
-
+        switch (node.typeID()) {
+        case NodeType::CORE_TransformationMatrixTypeID:
             m_model->setTransformMatrix(parseMatrix(characters, m_logger, getDocumentLocation()));
             return true;
-
-        } else if (node == NodeType::GML_PosNode) {
-
+        case NodeType::GML_PosTypeID:
             m_model->setReferencePoint(parseValue<TVec3d>(characters, m_logger, getDocumentLocation()));
             return true;
-        } else if (   node == NodeType::CORE_RelativeGMLGeometryNode
-                   || node == NodeType::GML_PointNode
-                   || node == NodeType::CORE_ReferencePointNode
-                   || node == NodeType::GML_ReferencePointNode
-                   || node == NodeType::CORE_LibraryObjectNode) {
-
+        case NodeType::CORE_RelativeGMLGeometryTypeID:
+        case NodeType::GML_PointTypeID:
+        case NodeType::CORE_ReferencePointTypeID:
+        case NodeType::GML_ReferencePointTypeID:
+        case NodeType::CORE_LibraryObjectTypeID:
             return true;
-        } else if (node == NodeType::CORE_MimeTypeNode) {
+        case NodeType::CORE_MimeTypeTypeID:
             m_model->setAttribute(node.name(), characters);
+            break;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementEndTag(node, characters);
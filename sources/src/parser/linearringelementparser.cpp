@@ -40,15 +40,15 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = new LinearRing(attributes.getCityGMLIDAttribute(), !m_interior);
+        m_model = m_factory.createLinearRing(getObjectID(attributes), !m_interior);
         return true;
 
     }
 
-    bool LinearRingElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool LinearRingElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         if (m_model->getVertices().size() < 4) {
-            CITYGML_LOG_WARN(m_logger, "LinearRing with end tag at " << getDocumentLocation() << " contains less than 4 vertices.");
+            CITYGML_LOG_WARN_TYPE(m_logger, CityGMLLogger::WARNINGTYPE::WT_RING_TOO_FEW_VERTICES, "LinearRing with end tag at " << getDocumentLocation() << " contains less than 4 vertices.");
         }
         m_callback(m_model);
         return true;
@@ -63,7 +63,7 @@ namespace citygml {
         }
 
         if (node == NodeType::GML_PosListNode || node == NodeType::GML_PosNode) {
-            std::string dimensions = attributes.getAttribute("srsDimension", "3");
+            std::string dimensions = attributes.getAttribute(AttributeName::SRSDimension, "3");
             if (dimensions != "3") {
                 CITYGML_LOG_WARN(m_logger, "Attribute srsDimension of element " << node << " contains unsupported value '" << dimensions << "' (only 3 dimensions are support). Trying to parse it anyway...");
             }
@@ -73,19 +73,22 @@ namespace citygml {
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool LinearRingElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool LinearRingElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
 
         if (m_model == nullptr) {
             throw std::runtime_error("LinearRingElementParser::parseChildElementEndTag called before LinearRingElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::GML_PosListNode) {
+        switch (node.typeID()) {
+        case NodeType::GML_PosListTypeID:
             m_model->setVertices(parseVecList<TVec3d>(characters, m_logger, getDocumentLocation()));
             return true;
-        } else if (node == NodeType::GML_PosNode) {
+        case NodeType::GML_PosTypeID:
             m_model->addVertex(parseValue<TVec3d>(characters, m_logger, getDocumentLocation()));
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementEndTag(node, characters);
@@ -28,6 +28,11 @@ namespace citygml {
     }
 
     bool LineStringElementParser::handlesElement(const NodeType::XMLNode& node) const
+    {
+        return isRootElement(node);
+    }
+
+    bool LineStringElementParser::isRootElement(const NodeType::XMLNode& node)
     {
         return node == NodeType::GML_LineStringNode || node == NodeType::GML_PointNode;
     }
@@ -40,7 +45,7 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createLineString(attributes.getCityGMLIDAttribute());
+        m_model = m_factory.createLineString(getObjectID(attributes));
 
         parseDimension(attributes);
 
@@ -48,7 +53,7 @@ namespace citygml {
 
     }
 
-    bool LineStringElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool LineStringElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         return true;
@@ -69,7 +74,7 @@ namespace citygml {
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool LineStringElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool LineStringElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
 
         if (m_model == nullptr) {
@@ -103,7 +108,7 @@ namespace citygml {
 
     void LineStringElementParser::parseDimension(Attributes& attributes)
     {
-        std::string dim_str = attributes.getAttribute("srsDimension", "");
+        std::string dim_str = attributes.getAttribute(AttributeName::SRSDimension);
 
         if (dim_str.empty()) {
             return;
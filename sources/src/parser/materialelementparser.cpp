@@ -29,6 +29,11 @@ namespace citygml {
     }
 
     bool MaterialElementParser::handlesElement(const NodeType::XMLNode& node) const
+    {
+        return isRootElement(node);
+    }
+
+    bool MaterialElementParser::isRootElement(const NodeType::XMLNode& node)
     {
         return node == NodeType::APP_MaterialNode || node == NodeType::APP_X3DMaterialNode;
     }
@@ -40,12 +45,12 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = std::shared_ptr<Material>(m_factory.createMaterial(attributes.getCityGMLIDAttribute()));
+        m_model = std::shared_ptr<Material>(m_factory.createMaterial(getObjectID(attributes)));
 
         return true;
     }
 
-    bool MaterialElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool MaterialElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         return true;
@@ -57,61 +62,64 @@ namespace citygml {
             throw std::runtime_error("MaterialElementParser::parseChildElementStartTag called before MaterialElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::APP_DiffuseColorNode
-            || node == NodeType::APP_EmissiveColorNode
-            || node == NodeType::APP_SpecularColorNode
-            || node == NodeType::APP_ShininessNode
-            || node == NodeType::APP_TransparencyNode
-            || node == NodeType::APP_AmbientIntensityNode
-            || node == NodeType::APP_IsFrontNode
-            || node == NodeType::APP_isSmoothNode) {
+        switch (node.typeID()) {
+        case NodeType::APP_DiffuseColorTypeID:
+        case NodeType::APP_EmissiveColorTypeID:
+        case NodeType::APP_SpecularColorTypeID:
+        case NodeType::APP_ShininessTypeID:
+        case NodeType::APP_TransparencyTypeID:
+        case NodeType::APP_AmbientIntensityTypeID:
+        case NodeType::APP_IsFrontTypeID:
+        case NodeType::APP_isSmoothTypeID:
             return true;
-        } else if (node == NodeType::APP_TargetNode) {
-            m_lastTargetDefinitionID = attributes.getCityGMLIDAttribute();
+        case NodeType::APP_TargetTypeID:
+            m_lastTargetDefinitionID = getObjectID(attributes);
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool MaterialElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool MaterialElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (m_model == nullptr) {
             throw std::runtime_error("MaterialElementParser::parseChildElementEndTag called before MaterialElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::APP_DiffuseColorNode) {
-
+        switch (node.typeID()) {
+        case NodeType::APP_DiffuseColorTypeID:
             m_model->setDiffuse(parseValue<TVec3f>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_EmissiveColorNode) {
-
+            return true;
+        case NodeType::APP_EmissiveColorTypeID:
             m_model->setEmissive(parseValue<TVec3f>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_SpecularColorNode) {
-
+            return true;
+        case NodeType::APP_SpecularColorTypeID:
             m_model->setSpecular(parseValue<TVec3f>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_ShininessNode) {
-
+            return true;
+        case NodeType::APP_ShininessTypeID:
             m_model->setShininess(parseValue<float>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_TransparencyNode) {
-
+            return true;
+        case NodeType::APP_TransparencyTypeID:
             m_model->setTransparency(parseValue<float>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_AmbientIntensityNode) {
-
+            return true;
+        case NodeType::APP_AmbientIntensityTypeID:
             m_model->setAmbientIntensity(parseValue<float>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_IsFrontNode) {
-
+            return true;
+        case NodeType::APP_IsFrontTypeID:
             m_model->setIsFront(parseValue<bool>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_isSmoothNode) {
-
+            return true;
+        case NodeType::APP_isSmoothTypeID:
             m_model->setIsSmooth(parseValue<bool>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_TargetNode) {
-
-            m_factory.createMaterialTargetDefinition(parseReference(characters, m_logger, getDocumentLocation()), m_model, m_lastTargetDefinitionID);
-            m_lastTargetDefinitionID = "";
-        }  else {
+            return true;
+        case NodeType::APP_TargetTypeID:
+            m_factory.createMaterialTargetDefinition(parseReference(characters, m_logger, getDocumentLocation()), m_model, m_lastTargetDefinitionID, getDocumentPosition(getDocumentLocation()));
+            m_lastTargetDefinitionID = ObjectID();
+            return true;
+        default:
             return GMLObjectElementParser::parseChildElementEndTag(node, characters);
         }
-        return true;
     }
 
     Object* MaterialElementParser::getObject()
@@ -0,0 +1,147 @@
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "parser/memorymappedfile.h"
+
+namespace citygml {
+
+    MemoryMappedFile::MemoryMappedFile()
+        : m_data(nullptr)
+        , m_size(0)
+#ifdef WIN32
+        , m_file(INVALID_HANDLE_VALUE)
+        , m_mapping(nullptr)
+#endif
+    {
+
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+#ifdef WIN32
+
+    bool MemoryMappedFile::open(const std::string& fileName)
+    {
+        close();
+
+        m_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(m_file, &fileSize)) {
+            close();
+            return false;
+        }
+
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        if (m_size == 0) {
+            // Empty files can not be mapped
+            return true;
+        }
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping == nullptr) {
+            close();
+            return false;
+        }
+
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr) {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (m_data != nullptr) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr) {
+            CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+        }
+
+        m_data = nullptr;
+        m_size = 0;
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+    }
+
+#else
+
+    bool MemoryMappedFile::open(const std::string& fileName)
+    {
+        close();
+
+        const int file = ::open(fileName.c_str(), O_RDONLY);
+        if (file == -1) {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(file, &fileStat) != 0) {
+            ::close(file);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        if (size == 0) {
+            // Empty files can not be mapped
+            ::close(file);
+            return true;
+        }
+
+        // The mapping stays valid after the file is closed
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+
+        if (data == MAP_FAILED) {
+            return false;
+        }
+
+        m_data = static_cast<const char*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (m_data != nullptr) {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+#endif
+
+    const char* MemoryMappedFile::data() const
+    {
+        return m_data;
+    }
+
+    size_t MemoryMappedFile::size() const
+    {
+        return m_size;
+    }
+
+}
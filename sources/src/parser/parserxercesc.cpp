@@ -16,16 +16,26 @@
 
 #include <citygml/citygml.h>
 #include <citygml/citygmllogger.h>
+#include <citygml/aggregatinglogger.h>
+#include <citygml/loadstatistics.h>
 
+#include <cstring>
+#include <exception>
 #include <fstream>
 #include <string>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <citygml/citygml_api.h>
 #include "parser/citygmldocumentparser.h"
 #include "parser/documentlocation.h"
 #include "parser/attributes.h"
+#include "parser/characterdata.h"
+#include "parser/documentchunks.h"
+#include "parser/memorymappedfile.h"
 
 #include <xercesc/sax2/DefaultHandler.hpp>
 #include <xercesc/sax/Locator.hpp>
@@ -36,6 +46,7 @@
 #include <xercesc/sax/InputSource.hpp>
 #include <xercesc/util/BinInputStream.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
+#include <xercesc/framework/MemBufInputSource.hpp>
 #include <xercesc/util/PlatformUtils.hpp>
 
 using namespace citygml;
@@ -52,6 +63,25 @@ std::string toStdString( const XMLCh* const wstr )
     return str;
 }
 
+static_assert(sizeof(XMLCh) == sizeof(char16_t), "XMLCh must be a UTF-16 code unit");
+
+// Assigns wstr to str reusing the memory of str. ASCII text is copied directly, everything else is transcoded.
+void assignStdString( const XMLCh* const wstr, std::string& str )
+{
+    str.clear();
+    if (wstr == nullptr) {
+        return;
+    }
+
+    for (const XMLCh* it = wstr; *it != 0; ++it) {
+        if (*it >= 0x80) {
+            str = toStdString(wstr);
+            return;
+        }
+        str.push_back(static_cast<char>(*it));
+    }
+}
+
 std::shared_ptr<XMLCh> toXercesString(const std::string& str) {
 
     XMLCh* conv = xercesc::XMLString::transcode(str.c_str());
@@ -66,6 +96,9 @@ public:
     explicit DocumentLocationXercesAdapter(const std::string& fileName)
 		: m_locator(nullptr)
 		, m_fileName(fileName)
+		, m_firstLine(0)
+		, m_lineOffset(0)
+		, m_columnOffset(0)
 	{
         
     }
@@ -74,23 +107,46 @@ public:
         m_locator = locator;
     }
 
+    // Maps the locations of a document chunk to the locations in the original document
+    void setChunk(const DocumentChunk& chunk) {
+        m_firstLine = chunk.firstLine;
+        m_lineOffset = chunk.lineOffset;
+        m_columnOffset = chunk.columnOffset;
+    }
+
     // DocumentLocation interface
     virtual const std::string& getDocumentFileName() const {
         return m_fileName;
     }
 
     virtual uint64_t getCurrentLine() const {
-        return m_locator != nullptr ? m_locator->getLineNumber() : 0;
+        if (m_locator == nullptr) {
+            return 0;
+        }
+        const uint64_t line = m_locator->getLineNumber();
+        return line >= m_firstLine ? line + m_lineOffset : line;
     }
     virtual uint64_t getCurrentColumn() const {
-        return m_locator != nullptr ? m_locator->getColumnNumber() : 0;
+        if (m_locator == nullptr) {
+            return 0;
+        }
+        const uint64_t column = m_locator->getColumnNumber();
+        return m_locator->getLineNumber() == m_firstLine ? column + m_columnOffset : column;
     }
 
 protected:
     const xercesc::Locator* m_locator;
     std::string m_fileName;
+    uint64_t m_firstLine;
+    int64_t m_lineOffset;
+    int64_t m_columnOffset;
 };
 
+// The qualified names of the common attributes in the order of citygml::AttributeName
+const char16_t* const xercesAttributeNames[] = { u"gml:id", u"xlink:href", u"srsName", u"srsDimension", u"orientation", u"name", u"uri", u"ring" };
+static_assert(sizeof(xercesAttributeNames) / sizeof(xercesAttributeNames[0]) == static_cast<size_t>(citygml::AttributeName::Count),
+              "xercesAttributeNames must contain the name of every citygml::AttributeName");
+
 class AttributesXercesAdapter : public citygml::Attributes {
 public:
     AttributesXercesAdapter(const xercesc::Attributes& attrs, const citygml::DocumentLocation& docLoc, std::shared_ptr<CityGMLLogger> logger)
@@ -103,6 +159,12 @@ public:
         return value.empty() ? defvalue : value;
     }
 
+    virtual bool findAttribute(citygml::AttributeName name, std::string& value) const override {
+        const XMLCh* qname = reinterpret_cast<const XMLCh*>(xercesAttributeNames[static_cast<size_t>(name)]);
+        assignStdString(m_attrs.getValue(qname), value);
+        return !value.empty();
+    }
+
     virtual const DocumentLocation& getDocumentLocation() const {
         return m_location;
     }
@@ -112,27 +174,66 @@ protected:
     const citygml::DocumentLocation& m_location;
 };
 
+// The character data of an element in the buffer of the handler. Numbers are parsed directly from the buffer.
+class CharacterDataXercesAdapter : public citygml::CharacterData {
+public:
+    CharacterDataXercesAdapter(const XMLCh* begin, const XMLCh* end)
+     : citygml::CharacterData(reinterpret_cast<const char16_t*>(begin), reinterpret_cast<const char16_t*>(end)) {}
+
+protected:
+    // CharacterData interface
+    virtual std::string transcode(const char16_t* begin, const char16_t* end) const override {
+        std::vector<XMLCh> text(reinterpret_cast<const XMLCh*>(begin), reinterpret_cast<const XMLCh*>(end));
+        text.push_back(0);
+        return toStdString(text.data());
+    }
+};
+
 // CityGML Xerces-c SAX parsing handler
 class CityGMLHandlerXerces : public xercesc::DefaultHandler, public citygml::CityGMLDocumentParser
 {
 public:
     CityGMLHandlerXerces( const ParserParams& params, const std::string& fileName, std::shared_ptr<CityGMLLogger> logger)
-        : citygml::CityGMLDocumentParser(params, logger), m_documentLocation(DocumentLocationXercesAdapter(fileName)) {}
+        : citygml::CityGMLDocumentParser(params, logger), m_documentLocation(DocumentLocationXercesAdapter(fileName)), m_collectCharacters(false) {}
 
 
     // ContentHandler interface
     virtual void startElement(const XMLCh* const, const XMLCh* const, const XMLCh* const qname, const xercesc::Attributes& attrs) override {
         AttributesXercesAdapter attributes(attrs, m_documentLocation, m_logger);
-        CityGMLDocumentParser::startElement(toStdString(qname), attributes);
+
+        // Text in front of the start tag belongs to the parent element (mixed content is not evaluated)
+        m_characters.clear();
+
+        // Resolve the node directly from the qname, the transcoded name is only required to report unknown elements
+        const NodeType::XMLNode& node = NodeType::getXMLNodeFor(qname, qname + xercesc::XMLString::stringLen(qname));
+        if (node.valid()) {
+            CityGMLDocumentParser::startElement(node, attributes);
+        } else {
+            CityGMLDocumentParser::startElement(toStdString(qname), attributes);
+        }
+
+        m_collectCharacters = isCharacterDataRequired();
     }
 
     virtual void endElement(const XMLCh* const, const XMLCh* const, const XMLCh* const qname) override {
-        CityGMLDocumentParser::endElement(toStdString(qname), m_lastcharacters);
-        m_lastcharacters = "";
+        const NodeType::XMLNode& node = NodeType::getXMLNodeFor(qname, qname + xercesc::XMLString::stringLen(qname));
+        if (node.valid()) {
+            CharacterDataXercesAdapter characters(m_characters.data(), m_characters.data() + m_characters.size());
+            CityGMLDocumentParser::endElement(node, characters);
+        } else {
+            CityGMLDocumentParser::endElement(toStdString(qname), std::string());
+        }
+
+        // Text behind the end tag belongs to the parent element
+        m_characters.clear();
+        m_collectCharacters = false;
     }
 
-    virtual void characters(const XMLCh* const chars, const XMLSize_t) override {
-        m_lastcharacters = toStdString(chars);
+    virtual void characters(const XMLCh* const chars, const XMLSize_t length) override {
+        // Xerces may report the text of an element in several calls (e.g. at the end of its buffer)
+        if (m_collectCharacters) {
+            m_characters.insert(m_characters.end(), chars, chars + length);
+        }
     }
 
     virtual void startDocument() override {
@@ -147,13 +248,21 @@ public:
         m_documentLocation.setLocator(locator);
     }
 
+    void setDocumentChunk(const DocumentChunk& chunk, uint32_t chunkIndex) {
+        CityGMLDocumentParser::setDocumentChunk(chunkIndex);
+        m_documentLocation.setChunk(chunk);
+    }
+
     // CityGMLDocumentParser interface
     virtual const citygml::DocumentLocation& getDocumentLocation() const override {
         return m_documentLocation;
     }
 protected:
     DocumentLocationXercesAdapter m_documentLocation;
-    std::string m_lastcharacters;
+
+    // The character data of the current element. The buffer is reused for all elements.
+    std::vector<XMLCh> m_characters;
+    bool m_collectCharacters;
 
 };
 
@@ -197,6 +306,105 @@ private:
     std::istream& m_stream;
 };
 
+// Reads a sequence of memory segments as one stream, e.g. a document chunk enclosed by the prolog and the end tag of the document
+class SegmentsBinInputStream : public xercesc::BinInputStream
+{
+public:
+    typedef std::vector<std::pair<const char*, size_t> > Segments;
+
+    explicit SegmentsBinInputStream( const Segments& segments ) : BinInputStream(), m_segments( segments ), m_segment( 0 ), m_offset( 0 ), m_pos( 0 ) {}
+
+    virtual ~SegmentsBinInputStream() {}
+
+    virtual XMLFilePos curPos() const { return m_pos; }
+
+    virtual XMLSize_t readBytes( XMLByte* const buf, const XMLSize_t maxToRead )
+    {
+        XMLSize_t read = 0;
+        while ( read < maxToRead && m_segment < m_segments.size() ) {
+            const std::pair<const char*, size_t>& segment = m_segments[m_segment];
+            size_t count = segment.second - m_offset;
+            if ( count > maxToRead - read ) count = maxToRead - read;
+
+            memcpy( buf + read, segment.first + m_offset, count );
+            read += count;
+            m_offset += count;
+
+            if ( m_offset == segment.second ) {
+                m_segment++;
+                m_offset = 0;
+            }
+        }
+        m_pos += read;
+        return read;
+    }
+
+    virtual const XMLCh* getContentType() const { return nullptr; }
+
+private:
+    Segments m_segments;
+    size_t m_segment;
+    size_t m_offset;
+    XMLFilePos m_pos;
+};
+
+class SegmentsBinInputSource : public xercesc::InputSource
+{
+public:
+    explicit SegmentsBinInputSource( const SegmentsBinInputStream::Segments& segments ) : m_segments( segments ) {}
+
+    virtual xercesc::BinInputStream* makeStream() const
+    {
+        return new SegmentsBinInputStream( m_segments );
+    }
+
+private:
+    SegmentsBinInputStream::Segments m_segments;
+};
+
+// Counts the bytes read from the stream of another input source (see LoadStatistics::bytesRead)
+class CountingBinInputStream : public xercesc::BinInputStream
+{
+public:
+    CountingBinInputStream( xercesc::BinInputStream* stream, uint64_t& bytesRead ) : BinInputStream(), m_stream( stream ), m_bytesRead( bytesRead ) {}
+
+    virtual ~CountingBinInputStream() {}
+
+    virtual XMLFilePos curPos() const { return m_stream->curPos(); }
+
+    virtual XMLSize_t readBytes( XMLByte* const buf, const XMLSize_t maxToRead )
+    {
+        const XMLSize_t read = m_stream->readBytes( buf, maxToRead );
+        m_bytesRead += read;
+        return read;
+    }
+
+    virtual const XMLCh* getContentType() const { return m_stream->getContentType(); }
+
+private:
+    std::unique_ptr<xercesc::BinInputStream> m_stream;
+    uint64_t& m_bytesRead;
+};
+
+class CountingInputSource : public xercesc::InputSource
+{
+public:
+    CountingInputSource( xercesc::InputSource& source, uint64_t& bytesRead ) : m_source( source ), m_bytesRead( bytesRead )
+    {
+        setSystemId( source.getSystemId() );
+    }
+
+    virtual xercesc::BinInputStream* makeStream() const
+    {
+        xercesc::BinInputStream* stream = m_source.makeStream();
+        return stream != nullptr ? new CountingBinInputStream( stream, m_bytesRead ) : nullptr;
+    }
+
+private:
+    xercesc::InputSource& m_source;
+    uint64_t& m_bytesRead;
+};
+
 // Parsing methods
 namespace citygml
 {
@@ -238,7 +446,10 @@ namespace citygml
                 stream << "]";
             }
 
-            stream << " " << message << std::endl;
+            stream << " " << message << "\n";
+            if (level == LOGLEVEL::LL_ERROR) {
+                stream.flush();
+            }
         }     
     };
 
@@ -269,11 +480,7 @@ namespace citygml
 
     }
 
-    std::shared_ptr<const CityModel> parse(xercesc::InputSource& stream, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger, std::string filename = "") {
-
-
-
-        CityGMLHandlerXerces handler( params, filename, logger );
+    void parseDocument(xercesc::InputSource& stream, CityGMLHandlerXerces& handler, std::shared_ptr<CityGMLLogger> logger) {
 
         xercesc::SAX2XMLReader* parser = xercesc::XMLReaderFactory::createXMLReader();
         parser->setFeature(xercesc::XMLUni::fgSAX2CoreNameSpaces, false);
@@ -302,10 +509,151 @@ namespace citygml
 #endif
 
         delete parser;
+    }
+
+    /**
+     * @brief wraps the logger into an AggregatingLogger if ParserParams::aggregateWarnings is set and logs the summary of the warnings when
+     *        the parsing is finished
+     *
+     * If the logger is an AggregatingLogger already the caller retrieves the summary.
+     */
+    class WarningAggregationScope {
+    public:
+        WarningAggregationScope(const ParserParams& params, std::shared_ptr<CityGMLLogger>& logger)
+        {
+            if (params.aggregateWarnings && !std::dynamic_pointer_cast<AggregatingLogger>(logger)) {
+                m_logger = std::make_shared<AggregatingLogger>(logger, params.maxWarningExamples);
+                logger = m_logger;
+            }
+        }
+
+        ~WarningAggregationScope()
+        {
+            if (m_logger) {
+                m_logger->logSummary();
+            }
+        }
+
+    private:
+        std::shared_ptr<AggregatingLogger> m_logger;
+    };
+
+    std::shared_ptr<const CityModel> parse(xercesc::InputSource& stream, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger, std::string filename = "", CityObjectCallback callback = nullptr) {
+
+        WarningAggregationScope warningAggregation(params, logger);
+
+        CityGMLHandlerXerces handler( params, filename, logger );
+        handler.setCityObjectCallback(callback);
+
+        if (params.statistics != nullptr) {
+            uint64_t bytesRead = 0;
+            CountingInputSource countingStream(stream, bytesRead);
+            parseDocument(countingStream, handler, logger);
+            params.statistics->bytesRead = bytesRead;
+        } else {
+            parseDocument(stream, handler, logger);
+        }
 
         return handler.getModel();
     }
 
+    // Chunks smaller than this are not worth a thread of their own
+    const size_t MIN_DOCUMENT_CHUNK_SIZE = 1024 * 1024;
+
+    std::shared_ptr<const CityModel> parseChunks(const char* data, const DocumentChunks& chunks, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger, const std::string& filename) {
+
+        WarningAggregationScope warningAggregation(params, logger);
+
+        std::vector<std::unique_ptr<CityGMLHandlerXerces> > handlers;
+        for (const DocumentChunk& chunk : chunks.chunks) {
+            handlers.push_back(std::unique_ptr<CityGMLHandlerXerces>(new CityGMLHandlerXerces( params, filename, logger )));
+            handlers.back()->setDocumentChunk(chunk, static_cast<uint32_t>(handlers.size() - 1));
+        }
+
+        std::vector<std::exception_ptr> errors(chunks.chunks.size());
+
+        auto parseChunk = [&](size_t i) {
+            try {
+                const DocumentChunk& chunk = chunks.chunks[i];
+                SegmentsBinInputStream::Segments segments;
+                segments.push_back(std::make_pair(data, chunks.prologEnd));
+                segments.push_back(std::make_pair(data + chunk.begin, chunk.end - chunk.begin));
+                segments.push_back(std::make_pair(data + chunks.rootEndTagBegin, chunks.rootEndTagEnd - chunks.rootEndTagBegin));
+
+                SegmentsBinInputSource chunkSource(segments);
+                parseDocument(chunkSource, *handlers[i], logger);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < chunks.chunks.size(); i++) {
+            threads.push_back(std::thread(parseChunk, i));
+        }
+        parseChunk(0);
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        for (std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        CityGMLHandlerXerces& handler = *handlers.front();
+        for (size_t i = 1; i < handlers.size(); i++) {
+            handler.mergeDocumentChunk(*handlers[i]);
+            handlers[i].reset();
+        }
+
+#ifdef NDEBUG
+        try
+        {
+#endif
+            handler.finishDocument();
+#ifdef NDEBUG
+        }
+        catch ( const std::exception& e )
+        {
+            CITYGML_LOG_ERROR(logger, "Unexpected Exception occurred: " << e.what());
+        }
+#endif
+
+        return handler.getModel();
+    }
+
+    std::shared_ptr<const CityModel> parseBuffer(const char* data, size_t size, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger, const std::string& filename)
+    {
+        const unsigned int parserThreadCount = params.parserThreadCount == 0 ? std::thread::hardware_concurrency() : params.parserThreadCount;
+
+        DocumentChunks chunks;
+        if (parserThreadCount > 1 && splitDocumentAtCityObjectMembers(data, size, parserThreadCount, MIN_DOCUMENT_CHUNK_SIZE, chunks, logger)) {
+            CITYGML_LOG_INFO(logger, "Parsing " << (filename.empty() ? "buffer" : filename) << " in " << chunks.chunks.size() << " chunks.");
+            std::shared_ptr<const CityModel> model = parseChunks(data, chunks, params, logger, filename);
+            if (params.statistics != nullptr) {
+                params.statistics->bytesRead = size;
+            }
+            return model;
+        }
+
+        xercesc::MemBufInputSource bufferSource(reinterpret_cast<const XMLByte*>(data), size, filename.empty() ? "citygml buffer" : filename.c_str());
+        return parse(bufferSource, params, logger, filename);
+    }
+
+    std::shared_ptr<const CityModel> parseMemoryMapped(const std::string& fname, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger)
+    {
+        MemoryMappedFile file;
+        if (!file.open(fname)) {
+            CITYGML_LOG_ERROR(logger, "Error parsing file " << fname << ": the file could not be opened or mapped into memory.");
+            return nullptr;
+        }
+
+        return parseBuffer(file.data(), file.size(), params, logger, fname);
+    }
+
     std::shared_ptr<const CityModel> load(std::istream& stream, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger)
     {
         if (!logger) {
@@ -320,7 +668,7 @@ namespace citygml
         return parse(streamSource, params, logger);
     }
 
-    std::shared_ptr<const CityModel> load( const std::string& fname, const ParserParams& params , std::shared_ptr<CityGMLLogger> logger)
+    std::shared_ptr<const CityModel> loadFile( const std::string& fname, const ParserParams& params , std::shared_ptr<CityGMLLogger> logger, CityObjectCallback callback)
     {
         if (!logger) {
             logger = std::make_shared<StdLogger>();
@@ -330,13 +678,18 @@ namespace citygml
             return nullptr;
         }
 
+        const unsigned int parserThreadCount = params.parserThreadCount == 0 ? std::thread::hardware_concurrency() : params.parserThreadCount;
+        if (!callback && parserThreadCount > 1) {
+            return parseMemoryMapped(fname, params, logger);
+        }
+
         std::shared_ptr<XMLCh> fileName = toXercesString(fname);
 
 #ifdef NDEBUG
         try {
 #endif
             xercesc::LocalFileInputSource fileSource(fileName.get());
-            return parse(fileSource, params, logger, fname);
+            return parse(fileSource, params, logger, fname, callback);
 #ifdef NDEBUG
         } catch (xercesc::XMLException& e) {
             CITYGML_LOG_ERROR(logger, "Error parsing file " << fname << ": " << e.getMessage());
@@ -345,5 +698,55 @@ namespace citygml
 #endif
 
     }
+
+    std::shared_ptr<const CityModel> load( const std::string& fname, const ParserParams& params , std::shared_ptr<CityGMLLogger> logger)
+    {
+        return loadFile(fname, params, logger, nullptr);
+    }
+
+    std::shared_ptr<const CityModel> load( const char* data, size_t size, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger)
+    {
+        if (!logger) {
+            logger = std::make_shared<StdLogger>();
+        }
+
+        if (!initXerces(logger)) {
+            return nullptr;
+        }
+
+        return parseBuffer(data, size, params, logger, "");
+    }
+
+    std::shared_ptr<const CityModel> loadMemoryMapped( const std::string& fname, const ParserParams& params, std::shared_ptr<CityGMLLogger> logger)
+    {
+        if (!logger) {
+            logger = std::make_shared<StdLogger>();
+        }
+
+        if (!initXerces(logger)) {
+            return nullptr;
+        }
+
+        return parseMemoryMapped(fname, params, logger);
+    }
+
+    std::shared_ptr<const CityModel> streamCityObjects(std::istream& stream, const ParserParams& params, CityObjectCallback callback, std::shared_ptr<CityGMLLogger> logger)
+    {
+        if (!logger) {
+            logger = std::make_shared<StdLogger>();
+        }
+
+        if (!initXerces(logger)) {
+            return nullptr;
+        }
+
+        StdBinInputSource streamSource(stream);
+        return parse(streamSource, params, logger, "", callback);
+    }
+
+    std::shared_ptr<const CityModel> streamCityObjects( const std::string& fname, const ParserParams& params, CityObjectCallback callback, std::shared_ptr<CityGMLLogger> logger)
+    {
+        return loadFile(fname, params, logger, callback);
+    }
 }
 
@@ -11,17 +11,10 @@
 #include <citygml/citygmlfactory.h>
 #include <citygml/citygmllogger.h>
 
-#include <mutex>
 #include <stdexcept>
 
 namespace citygml {
 
-
-    // The nodes that are valid Polygon Objects
-    std::unordered_set<int> typeIDSet;
-    bool typeIDSetInitialized = false;
-    std::mutex polygonElementParser_initializedTypeIDMutex;
-
     PolygonElementParser::PolygonElementParser(CityGMLDocumentParser& documentParser, CityGMLFactory& factory, std::shared_ptr<CityGMLLogger> logger, std::function<void(std::shared_ptr<Polygon>)> callback)
         : GMLObjectElementParser(documentParser, factory, logger)
     {
@@ -35,19 +28,21 @@ namespace citygml {
 
     bool PolygonElementParser::handlesElement(const NodeType::XMLNode& node) const
     {
-        if (!typeIDSetInitialized) {
-            std::lock_guard<std::mutex> lock(polygonElementParser_initializedTypeIDMutex);
-
-            if(!typeIDSetInitialized) {
-                typeIDSet.insert(NodeType::GML_TriangleNode.typeID());
-                typeIDSet.insert(NodeType::GML_RectangleNode.typeID());
-                typeIDSet.insert(NodeType::GML_PolygonNode.typeID());
-                typeIDSet.insert(NodeType::GML_PolygonPatchNode.typeID());
-                typeIDSetInitialized = true;
-            }
-        }
+        return isRootElement(node);
+    }
 
-        return typeIDSet.count(node.typeID()) > 0;
+    bool PolygonElementParser::isRootElement(const NodeType::XMLNode& node)
+    {
+        // The nodes that are valid Polygon Objects
+        switch (node.typeID()) {
+        case NodeType::GML_TriangleTypeID:
+        case NodeType::GML_RectangleTypeID:
+        case NodeType::GML_PolygonTypeID:
+        case NodeType::GML_PolygonPatchTypeID:
+            return true;
+        default:
+            return false;
+        }
     }
 
     bool PolygonElementParser::parseElementStartTag(const NodeType::XMLNode& node, Attributes& attributes)
@@ -58,12 +53,12 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createPolygon(attributes.getCityGMLIDAttribute());
+        m_model = m_factory.createPolygon(getObjectID(attributes));
         return true;
 
     }
 
-    bool PolygonElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool PolygonElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         return true;
@@ -77,20 +72,21 @@ namespace citygml {
             throw std::runtime_error("PolygonElementParser::parseChildElementStartTag called before PolygonElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::GML_InteriorNode) {
-
+        switch (node.typeID()) {
+        case NodeType::GML_InteriorTypeID:
             parseRingElement(true);
             return true;
-        } else if (node == NodeType::GML_ExteriorNode) {
-
+        case NodeType::GML_ExteriorTypeID:
             parseRingElement(false);
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool PolygonElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool PolygonElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
 
         if (m_model == nullptr) {
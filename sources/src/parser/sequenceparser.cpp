@@ -22,7 +22,7 @@ namespace citygml {
         return childParser->startElement(node, attributes);
     }
 
-    bool SequenceParser::endElement(const NodeType::XMLNode& node, const std::string&)
+    bool SequenceParser::endElement(const NodeType::XMLNode& node, const CharacterData&)
     {
         if (node != m_containerType) {
             CITYGML_LOG_ERROR(m_logger, "Sequence parser was bound to container element <" << m_containerType << "> but found unexpected"
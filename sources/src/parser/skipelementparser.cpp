@@ -25,10 +25,15 @@ namespace citygml {
         return true;
     }
 
+    bool SkipElementParser::requiresCharacterData() const
+    {
+        return false;
+    }
+
     bool SkipElementParser::startElement(const NodeType::XMLNode& node, Attributes&)
     {
         if (!m_skipNode.valid()) {
-            CITYGML_LOG_TRACE(m_logger, "Skipping element <" << node << "> at " << getDocumentLocation());
+            CITYGML_LOG_IF(m_documentParser.isLogEnabledFor(CityGMLLogger::LOGLEVEL::LL_TRACE), m_logger, CityGMLLogger::LOGLEVEL::LL_TRACE, "Skipping element <" << node << "> at " << getDocumentLocation());
             m_skipNode = node;
             m_depth = 1;
         } else if (node == m_skipNode) {
@@ -38,7 +43,7 @@ namespace citygml {
         return true;
     }
 
-    bool SkipElementParser::endElement(const NodeType::XMLNode& node, const std::string&)
+    bool SkipElementParser::endElement(const NodeType::XMLNode& node, const CharacterData&)
     {
         if (!m_skipNode.valid()) {
             m_documentParser.removeCurrentElementParser(this);
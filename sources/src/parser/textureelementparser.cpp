@@ -33,6 +33,11 @@ namespace citygml {
     }
 
     bool TextureElementParser::handlesElement(const NodeType::XMLNode& node) const
+    {
+        return isRootElement(node);
+    }
+
+    bool TextureElementParser::isRootElement(const NodeType::XMLNode& node)
     {
         return node == NodeType::APP_ParameterizedTextureNode;
     }
@@ -44,11 +49,11 @@ namespace citygml {
             throw std::runtime_error("Unexpected start tag found.");
         }
 
-        m_model = m_factory.createTexture(attributes.getCityGMLIDAttribute());
+        m_model = m_factory.createTexture(getObjectID(attributes));
         return true;
     }
 
-    bool TextureElementParser::parseElementEndTag(const NodeType::XMLNode&, const std::string&)
+    bool TextureElementParser::parseElementEndTag(const NodeType::XMLNode&, const CharacterData&)
     {
         m_callback(m_model);
         return true;
@@ -60,57 +65,61 @@ namespace citygml {
             throw std::runtime_error("TextureElementParser::parseChildElementStartTag called before TextureElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::APP_ImageURINode
-            || node == NodeType::APP_TextureTypeNode
-            || node == NodeType::APP_WrapModeNode
-            || node == NodeType::APP_BorderColorNode
-            || node == NodeType::APP_TexCoordListNode
-            || node == NodeType::APP_IsFrontNode
-            || node == NodeType::APP_MimeTypeNode) {
+        switch (node.typeID()) {
+        case NodeType::APP_ImageURITypeID:
+        case NodeType::APP_TextureTypeTypeID:
+        case NodeType::APP_WrapModeTypeID:
+        case NodeType::APP_BorderColorTypeID:
+        case NodeType::APP_TexCoordListTypeID:
+        case NodeType::APP_IsFrontTypeID:
+        case NodeType::APP_MimeTypeTypeID:
             return true;
-        } else if (node == NodeType::APP_TargetNode) {
+        case NodeType::APP_TargetTypeID:
             if (m_currentTexTargetDef != nullptr) {
                 CITYGML_LOG_WARN(m_logger, "Nested texture target definition detected at: " << getDocumentLocation());
             } else {
-                m_currentTexTargetDef = m_factory.createTextureTargetDefinition(parseReference(attributes.getAttribute("uri"), m_logger, getDocumentLocation()), m_model, attributes.getCityGMLIDAttribute());
+                m_currentTexTargetDef = m_factory.createTextureTargetDefinition(parseReference(attributes.getAttribute(AttributeName::Uri), m_logger, getDocumentLocation()), m_model, getObjectID(attributes), getDocumentPosition(getDocumentLocation()));
             }
             return true;
-        } else if (node == NodeType::APP_TextureCoordinatesNode) {
+        case NodeType::APP_TextureCoordinatesTypeID:
             if (m_currentTexTargetDef == nullptr) {
                 CITYGML_LOG_WARN(m_logger, "Found texture coordinates node (" << NodeType::APP_TextureCoordinatesNode << ") outside Texture target node at: " << getDocumentLocation());
             } else if (m_currentTexCoords != nullptr) {
                 CITYGML_LOG_WARN(m_logger, "Nested texture coordinates definition detected at: " << getDocumentLocation());
             } else {
-                m_currentTexCoords = std::make_shared<TextureCoordinates>(attributes.getCityGMLIDAttribute(), parseReference(attributes.getAttribute("ring"), m_logger, getDocumentLocation()));
+                m_currentTexCoords = std::make_shared<TextureCoordinates>(getObjectID(attributes), parseReference(attributes.getAttribute(AttributeName::Ring), m_logger, getDocumentLocation()));
             }
             return true;
+        default:
+            break;
         }
 
         return GMLObjectElementParser::parseChildElementStartTag(node, attributes);
     }
 
-    bool TextureElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const std::string& characters)
+    bool TextureElementParser::parseChildElementEndTag(const NodeType::XMLNode& node, const CharacterData& characters)
     {
         if (m_model == nullptr) {
             throw std::runtime_error("TextureElementParser::parseChildElementEndTag called before TextureElementParser::parseElementStartTag");
         }
 
-        if (node == NodeType::APP_ImageURINode) {
-
+        switch (node.typeID()) {
+        case NodeType::APP_ImageURITypeID:
             m_model->setUrl(characters);
-        } else if (node == NodeType::APP_TextureTypeNode) {
-
+            return true;
+        case NodeType::APP_TextureTypeTypeID:
+        case NodeType::APP_MimeTypeTypeID:
             m_model->setAttribute(node.name(), characters);
-        } else if (node == NodeType::APP_WrapModeNode) {
-
+            return true;
+        case NodeType::APP_WrapModeTypeID:
             if (!m_model->setWrapModeFromString(characters)) {
                 CITYGML_LOG_WARN(m_logger, "Unknown texture wrap mode " << characters << " at: " << getDocumentLocation());
             }
-        } else if (node == NodeType::APP_IsFrontNode) {
-
+            return true;
+        case NodeType::APP_IsFrontTypeID:
             m_model->setIsFront(parseValue<bool>(characters, m_logger, getDocumentLocation()));
-        } else if (node == NodeType::APP_BorderColorNode) {
-
+            return true;
+        case NodeType::APP_BorderColorTypeID: {
             std::vector<float> colorValues = parseVecList<float>(characters, m_logger, getDocumentLocation());
             colorValues.push_back(1.f); // if 3 values are given, the fourth (alpha) is set to 1.0 by default
             if (colorValues.size() >= 4) {
@@ -118,15 +127,15 @@ namespace citygml {
             } else {
                 CITYGML_LOG_WARN(m_logger, "Expected 3 or more float values in node " << NodeType::APP_BorderColorNode << " but got " << colorValues.size() << " at: " << getDocumentLocation());
             }
-        } else if (node == NodeType::APP_TexCoordListNode) {
-
+            return true;
+        }
+        case NodeType::APP_TexCoordListTypeID:
             if (m_currentTexCoords != nullptr) {
                 CITYGML_LOG_WARN(m_logger, "TexCoordList node finished before TextureCoordinates child is finished at " << getDocumentLocation());
                 m_currentTexCoords = nullptr;
             }
-
-        } else if (node == NodeType::APP_TextureCoordinatesNode) {
-
+            return true;
+        case NodeType::APP_TextureCoordinatesTypeID:
             if (m_currentTexCoords != nullptr && m_currentTexTargetDef != nullptr) {
                 m_currentTexCoords->setCoords(parseVecList<TVec2f>(characters, m_logger, getDocumentLocation()));
                 m_currentTexTargetDef->addTexCoordinates(m_currentTexCoords);
@@ -134,15 +143,13 @@ namespace citygml {
             } else {
                 CITYGML_LOG_WARN(m_logger, "Unexpected end tag <" << NodeType::APP_TextureCoordinatesNode << " at: " << getDocumentLocation());
             }
-        } else if (node == NodeType::APP_TargetNode) {
-
+            return true;
+        case NodeType::APP_TargetTypeID:
             m_currentTexTargetDef = nullptr;
-        } else if (node == NodeType::APP_MimeTypeNode) {
-            m_model->setAttribute(node.name(), characters);
-        } else {
+            return true;
+        default:
             return GMLObjectElementParser::parseChildElementEndTag(node, characters);
         }
-        return true;
     }
 
     Object* TextureElementParser::getObject()
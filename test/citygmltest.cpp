@@ -17,6 +17,7 @@
 #include <iostream>
 #include <fstream>
 #include <time.h>
+#include <stdlib.h>
 #include <algorithm>
 #include <citygml/citygml.h>
 #include <citygml/citymodel.h>
@@ -42,6 +43,11 @@ void usage()
         << "                  \"All&~Track&~Room\" to parse everything but tracks & rooms" << std::endl
         << "                  \"Road&Railway\" to parse only roads & railways" << std::endl;
     std::cout << "  -destSRS <srs> Destination SRS (default: no transform)" << std::endl;
+    std::cout << "  -earclipping    Use the ear clipping tesselator instead of the GLU tesselator" << std::endl;
+    std::cout << "  -threads <n>    Number of threads used for tesselation, 0 for all hardware threads (default: 1)" << std::endl;
+    std::cout << "  -parserthreads <n> Number of threads used for parsing, 0 for all hardware threads (default: 1)" << std::endl;
+    std::cout << "  -mmap           Map the file into memory instead of reading it through a file stream" << std::endl;
+    std::cout << "  -stream         Stream the city objects instead of loading the whole city model" << std::endl;
     exit( EXIT_FAILURE );
 }
 
@@ -52,6 +58,8 @@ int main( int argc, char **argv )
     int fargc = 1;
 
     bool log = false;
+    bool stream = false;
+    bool mmap = false;
 
     citygml::ParserParams params;
 
@@ -62,6 +70,11 @@ int main( int argc, char **argv )
         if ( param == "-log" ) { log = true; fargc = i+1; }
         //if ( param == "-filter" ) { if ( i == argc - 1 ) usage(); params.objectsMask = argv[i+1]; i++; fargc = i+1; }
         if ( param == "-destsrs" ) { if ( i == argc - 1 ) usage(); params.destSRS = argv[i+1]; i++; fargc = i+1; }
+        if ( param == "-threads" ) { if ( i == argc - 1 ) usage(); params.threadCount = atoi( argv[i+1] ); i++; fargc = i+1; }
+        if ( param == "-parserthreads" ) { if ( i == argc - 1 ) usage(); params.parserThreadCount = atoi( argv[i+1] ); i++; fargc = i+1; }
+        if ( param == "-earclipping" ) { params.tesselatorType = citygml::TesselatorType::EarClipping; fargc = i+1; }
+        if ( param == "-stream" ) { stream = true; fargc = i+1; }
+        if ( param == "-mmap" ) { mmap = true; fargc = i+1; }
     }
 
     if ( argc - fargc < 1 ) usage();
@@ -78,8 +91,15 @@ int main( int argc, char **argv )
 #else
 
     std::shared_ptr<const citygml::CityModel> city;
+    size_t streamedObjects = 0;
     try{
-        city = citygml::load( argv[fargc], params );
+        if ( stream ) {
+            city = citygml::streamCityObjects( argv[fargc], params, [&streamedObjects]( std::unique_ptr<citygml::CityObject> ) { streamedObjects++; } );
+        } else if ( mmap ) {
+            city = citygml::loadMemoryMapped( argv[fargc], params );
+        } else {
+            city = citygml::load( argv[fargc], params );
+        }
     }catch(const std::runtime_error& e){
         
     }
@@ -92,6 +112,8 @@ int main( int argc, char **argv )
 
     std::cout << "Done in " << difftime( end, start ) << " seconds." << std::endl;
 
+    if ( stream ) std::cout << "Streamed " << streamedObjects << " city objects." << std::endl;
+
     /*
     std::cout << "Analyzing the city objects..." << std::endl;
 